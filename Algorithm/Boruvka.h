@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+#include "CSRGraph.h"
+#include "DisjointSet.h"
+#include "ThreadPool.h"
+#include "Kruskal.h"
+
+// 병렬 보루프카 알고리즘(Parallel Borůvka)
+//
+// 크루스칼은 가장 가벼운 간선부터 하나씩 확인하기 때문에 본질적으로 순차적이다.
+// 보루프카는 "각 컴포넌트에서 밖으로 나가는 가장 가벼운 간선은 반드시 최소 신장 트리에 포함된다"는 성질을 이용한다.
+// 모든 컴포넌트가 동시에 자기 간선을 고를 수 있기 때문에 병렬 처리에 적합하고
+// 라운드마다 컴포넌트의 수가 절반 이하로 줄어들어서 O(log V)번의 라운드면 끝난다.
+//
+// 라운드마다 다음 단계를 ThreadPool::ParallelFor()로 처리한다(각 단계가 끝날 때까지 다음 단계로 넘어가지 않음).
+// 1. 간선 구간마다 양 끝 정점의 루트를 찾고
+//    - 같은 컴포넌트라면 버린다(구간 안에서 앞쪽으로 당겨서 압축).
+//    - 다른 컴포넌트라면 두 루트의 cheapest 값을 atomic min으로 갱신한다(compare_exchange 반복문).
+// 2. cheapest가 있는 루트마다 그 간선으로 ConcurrentDisjointSet::Union()을 호출하고 성공하면 결과에 추가한다.
+//    두 컴포넌트가 같은 간선을 골랐다면 한쪽만 성공한다.
+// 3. 구간마다 남은 간선을 다음 라운드의 배열로 이어 붙인다.
+//
+// 가중치가 같은 간선이 있으면 사이클이 생길 수 있기 때문에 cheapest에는 (가중치, 간선 번호)를 하나의 64비트 값으로 묶어서
+// 모든 간선의 순서가 달라지도록 한다.
+
+namespace BoruvkaDetail
+{
+    constexpr uint64_t kNoEdge = std::numeric_limits<uint64_t>::max();
+
+    // 상위 32비트 : 가중치(부호 비트를 뒤집어서 음수도 순서가 유지되게 함), 하위 32비트 : 간선 번호
+    inline uint64_t MakeKey(int weight, size_t idx)
+    {
+        return ((uint64_t)((uint32_t)weight ^ 0x8000'0000u) << 32) | (uint64_t)idx;
+    }
+
+    inline void AtomicMin(std::atomic<uint64_t>& target, uint64_t value)
+    {
+        uint64_t old = target.load(std::memory_order_relaxed);
+
+        while (value < old)
+        {
+            if (true == target.compare_exchange_weak(old, value, std::memory_order_relaxed))
+                return;
+        }
+    }
+}
+
+inline SpanningTree ParallelBoruvka(int vertexCount, const std::vector<GraphEdge>& edges, ThreadPool& pool)
+{
+    using namespace BoruvkaDetail;
+
+    // MakeKey()가 간선 번호를 하위 32비트에 넣는다(모든 비트가 1인 값은 kNoEdge로 사용).
+    assert(edges.size() < std::numeric_limits<uint32_t>::max());
+
+    ConcurrentDisjointSet set{ vertexCount };
+
+    auto cheapest = std::make_unique<std::atomic<uint64_t>[]>(vertexCount);
+
+    pool.ParallelFor(vertexCount, [&](size_t v) {
+        cheapest[v].store(kNoEdge, std::memory_order_relaxed);
+    });
+
+    std::vector<GraphEdge> current = edges;
+    std::vector<GraphEdge> next(edges.size());
+
+    std::vector<GraphEdge> treeEdges(std::max(0, vertexCount - 1));
+    std::atomic<size_t>    treeCount = 0;
+
+    size_t chunkCount = (size_t)pool.ThreadCount() * 8;
+
+    std::vector<size_t> kept(chunkCount);
+    std::vector<size_t> offsets(chunkCount);
+
+    while (false == current.empty() && treeCount.load() < treeEdges.size())
+    {
+        size_t chunkSize = (current.size() + chunkCount - 1) / chunkCount;
+
+        // 1. 같은 컴포넌트의 간선을 버리고 컴포넌트마다 가장 가벼운 간선을 찾는다.
+        pool.ParallelFor(chunkCount, [&](size_t chunk) {
+            size_t first = std::min(chunk * chunkSize, current.size());
+            size_t last  = std::min(first + chunkSize, current.size());
+
+            size_t write = first;
+
+            for (size_t read = first; read < last; read++)
+            {
+                GraphEdge edge = current[read];
+
+                int rootFrom = set.Find(edge.from);
+                int rootTo   = set.Find(edge.to);
+
+                if (rootFrom == rootTo)
+                    continue;
+
+                uint64_t key = MakeKey(edge.weight, write);
+
+                AtomicMin(cheapest[rootFrom], key);
+                AtomicMin(cheapest[rootTo], key);
+
+                current[write++] = edge;
+            }
+
+            kept[chunk] = write - first;
+        });
+
+        // 2. 고른 간선으로 컴포넌트를 합친다.
+        pool.ParallelFor(vertexCount, [&](size_t v) {
+            uint64_t key = cheapest[v].load(std::memory_order_relaxed);
+
+            if (kNoEdge == key)
+                return;
+
+            cheapest[v].store(kNoEdge, std::memory_order_relaxed);
+
+            const GraphEdge& edge = current[key & 0xFFFF'FFFFu];
+
+            if (true == set.Union(edge.from, edge.to))
+            {
+                treeEdges[treeCount.fetch_add(1, std::memory_order_relaxed)] = edge;
+            }
+        });
+
+        // 3. 남은 간선을 이어 붙인다.
+        size_t total = 0;
+
+        for (size_t chunk = 0; chunk < chunkCount; chunk++)
+        {
+            offsets[chunk] = total;
+            total += kept[chunk];
+        }
+
+        next.resize(total);
+
+        pool.ParallelFor(chunkCount, [&](size_t chunk) {
+            size_t first = std::min(chunk * chunkSize, current.size());
+
+            std::copy_n(current.begin() + first, kept[chunk], next.begin() + offsets[chunk]);
+        });
+
+        current.swap(next);
+    }
+
+    SpanningTree tree;
+
+    tree.edges.assign(treeEdges.begin(), treeEdges.begin() + treeCount.load());
+
+    for (const GraphEdge& edge : tree.edges)
+    {
+        tree.weight += edge.weight;
+    }
+
+    return tree;
+}
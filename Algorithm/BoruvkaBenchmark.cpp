@@ -0,0 +1,95 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#include "GraphGenerator.h"
+#include "ThreadPool.h"
+#include "Kruskal.h"
+#include "Boruvka.h"
+
+// Boruvka.h의 ParallelBoruvka()와 Kruskal.h의 순차 버전 비교
+//
+// 간선이 천만 개 이상인 무방향 랜덤 그래프에서 스레드 개수를 늘려가며 측정한다.
+// 모든 결과의 가중치 합과 간선 개수가 같은지 확인한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+int main()
+{
+    constexpr int    kVertexCount = 1'000'000;
+    constexpr size_t kEdgeCount   = 16'000'000;
+
+    const vector<GraphEdge> edges = MakeRandomGraph(kVertexCount, kEdgeCount, 1'000'000);
+
+    cout << "V : " << kVertexCount << ", E : " << edges.size() << '\n';
+
+    vector<GraphEdge> work = edges;
+
+    SpanningTree radix;
+
+    double radixTime = Measure([&] { radix = KruskalRadix(kVertexCount, work); });
+
+    work = edges;
+
+    SpanningTree filter;
+
+    double filterTime = Measure([&] { filter = FilterKruskal(kVertexCount, work); });
+
+    cout << "KruskalRadix : " << radixTime << "s, FilterKruskal : " << filterTime << "s"
+         << ", weight : " << radix.weight << (radix.weight == filter.weight ? "" : " (Mismatch!)") << "\n\n";
+
+    int maxThreads = max(1u, thread::hardware_concurrency());
+
+    vector<int> threadCounts;
+
+    for (int threads = 1; threads < maxThreads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+
+    threadCounts.push_back(maxThreads);
+
+    double baseTime = 0.0;
+
+    for (int threads : threadCounts)
+    {
+        ThreadPool pool{ threads };
+
+        SpanningTree boruvka;
+
+        double elapsed = Measure([&] { boruvka = ParallelBoruvka(kVertexCount, edges, pool); });
+
+        if (1 == threads)
+        {
+            baseTime = elapsed;
+        }
+
+        bool isValid = (boruvka.weight == radix.weight) && (boruvka.edges.size() == radix.edges.size());
+
+        cout << "Boruvka threads : " << threads << ", " << elapsed << "s"
+             << ", speedup : " << baseTime / elapsed
+             << (isValid ? "" : " (Mismatch!)") << '\n';
+    }
+
+    return 0;
+}
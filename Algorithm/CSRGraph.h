@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <span>
+
+// CSR(Compressed Sparse Row) 그래프
+// : 인접 정보를 정점마다 따로 들고 있지 않고 3개의 배열에 몰아서 저장하는 방식
+//
+// offsets : 정점 v의 간선은 [offsets[v], offsets[v + 1]) 구간에 들어 있음(크기 V + 1).
+// targets : 간선이 향하는 정점(크기 E)
+// weights : 간선의 가중치(크기 E)
+//
+//  offsets | 0 | 2 | 3 | 5 |
+//            |       |   |
+//  targets | 1 | 2 | 2 | 0 | 1 |
+//  weights | 4 | 1 | 2 | 7 | 3 |
+//
+// vector<Edge> adj[N] 방식은 정점마다 동적할당이 일어나고 정점의 개수도 컴파일 타임에 고정된다.
+// CSR은 배열 3개만 할당하면 되고 간선 정보가 메모리 상에 연속적으로 배치되기 때문에 캐시 친화적이다.
+//
+// 대신 생성 이후에 간선을 추가하거나 삭제하는 것은 어렵다(정적인 그래프에 적합함).
+// 도로망처럼 한 번 구성하고 여러 번 조회하는 그래프라면 CSR을 쓰는 것이 좋다.
+
+// 정점 번호는 [0, vertexCount) 범위를 사용한다.
+// 1번 정점부터 사용하는 문제라면 vertexCount를 (V + 1)로 지정하면 된다.
+template <typename W = int>
+class CSRGraph
+{
+public:
+    struct Edge
+    {
+        int from;
+        int to;
+        W   weight;
+    };
+
+public:
+    CSRGraph() = default;
+
+    // 간선 목록을 받아서 한 번에 구성한다.
+    // 1. 정점 별 진출 차수 계산
+    // 2. 누적합으로 offsets 계산
+    // 3. 각 간선을 자기 구간에 배치(counting sort와 동일한 원리)
+    CSRGraph(int vertexCount, const std::vector<Edge>& edges, bool undirected = false)
+    {
+        size_t edgeCount = undirected ? edges.size() * 2 : edges.size();
+
+        _offsets.assign(vertexCount + 1, 0);
+        _targets.resize(edgeCount);
+        _weights.resize(edgeCount);
+
+        for (const Edge& edge : edges)
+        {
+            _offsets[edge.from + 1]++;
+
+            if (true == undirected)
+            {
+                _offsets[edge.to + 1]++;
+            }
+        }
+
+        for (int v = 0; v < vertexCount; v++)
+        {
+            _offsets[v + 1] += _offsets[v];
+        }
+
+        // 배치할 위치를 가리키는 커서(배치가 끝나면 버림)
+        std::vector<size_t> cursor(_offsets.begin(), _offsets.end() - 1);
+
+        for (const Edge& edge : edges)
+        {
+            size_t pos = cursor[edge.from]++;
+
+            _targets[pos] = edge.to;
+            _weights[pos] = edge.weight;
+
+            if (true == undirected)
+            {
+                pos = cursor[edge.to]++;
+
+                _targets[pos] = edge.from;
+                _weights[pos] = edge.weight;
+            }
+        }
+    }
+
+public:
+    int    VertexCount() const { return (int)_offsets.size() - 1; }
+    size_t EdgeCount() const   { return _targets.size(); }
+
+    // 간선 인덱스 기반 접근
+    size_t Begin(int v) const { return _offsets[v]; }
+    size_t End(int v) const   { return _offsets[v + 1]; }
+
+    int Target(size_t edgeIdx) const { return _targets[edgeIdx]; }
+    W   Weight(size_t edgeIdx) const { return _weights[edgeIdx]; }
+
+    int Degree(int v) const { return (int)(_offsets[v + 1] - _offsets[v]); }
+
+    // 정점 단위 접근
+    std::span<const int> Targets(int v) const { return { _targets.data() + _offsets[v], _targets.data() + _offsets[v + 1] }; }
+    std::span<const W>   Weights(int v) const { return { _weights.data() + _offsets[v], _weights.data() + _offsets[v + 1] }; }
+
+    // 벨만-포드처럼 모든 간선을 순회해야 하는 경우에 사용
+    template <typename Func>
+    void ForEachEdge(Func&& func) const
+    {
+        for (int from = 0; from < VertexCount(); from++)
+        {
+            for (size_t idx = _offsets[from]; idx < _offsets[from + 1]; idx++)
+            {
+                func(from, _targets[idx], _weights[idx]);
+            }
+        }
+    }
+
+    // 모든 간선의 방향을 뒤집은 그래프(양방향 탐색에서 도착 지점부터 거꾸로 탐색할 때 사용)
+    CSRGraph Transpose() const
+    {
+        std::vector<Edge> edges;
+        edges.reserve(EdgeCount());
+
+        this->ForEachEdge([&](int from, int to, W weight) {
+            edges.push_back({ to, from, weight });
+        });
+
+        return CSRGraph{ VertexCount(), edges };
+    }
+
+    // 그래프가 차지하는 메모리의 크기(바이트)
+    size_t MemoryUsage() const
+    {
+        return _offsets.size() * sizeof(size_t) + _targets.size() * sizeof(int) + _weights.size() * sizeof(W);
+    }
+
+private:
+    std::vector<size_t> _offsets;
+    std::vector<int>    _targets;
+    std::vector<W>      _weights;
+};
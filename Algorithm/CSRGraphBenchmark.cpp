@@ -0,0 +1,198 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <queue>
+#include <limits>
+
+#include "CSRGraph.h"
+#include "GraphGenerator.h"
+
+// CSRGraph.h에 작성한 CSR 레이아웃과 Dijkstra.cpp에서 사용하는 vector<Edge> adj[] 레이아웃의 순회 성능 비교
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+//
+// - 구성 : 간선 목록으로부터 그래프를 만드는 데 걸리는 시간
+// - 순회 : 모든 정점의 모든 간선을 한 번씩 읽는 데 걸리는 시간(벨만-포드의 한 패스와 동일한 접근 패턴)
+// - 다익스트라 : 정점 0에서 시작하는 다익스트라 한 번을 수행하는 데 걸리는 시간
+//
+// vector<Edge> 방식은 정점마다 힙 할당이 일어나고 각 정점의 간선이 메모리 여기저기에 흩어진다.
+// CSR 방식은 간선 정보가 연속적으로 배치되기 때문에 순회할 때 캐시 미스가 적다.
+//
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int    kVertexCount = 2'000'000;
+constexpr size_t kEdgeCount   = 16'000'000;
+constexpr int    kMaxWeight   = 100;
+
+constexpr int INF = numeric_limits<int>::max();
+
+struct Edge
+{
+    int to;
+    int weight;
+};
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+int64_t SweepAdjacency(const vector<vector<Edge>>& adj)
+{
+    int64_t sum = 0;
+
+    for (const vector<Edge>& edges : adj)
+    {
+        for (const Edge& edge : edges)
+        {
+            sum += edge.to ^ edge.weight;
+        }
+    }
+
+    return sum;
+}
+
+int64_t SweepCSR(const CSRGraph<int>& graph)
+{
+    int64_t sum = 0;
+
+    for (int v = 0; v < graph.VertexCount(); v++)
+    {
+        for (size_t idx = graph.Begin(v); idx < graph.End(v); idx++)
+        {
+            sum += graph.Target(idx) ^ graph.Weight(idx);
+        }
+    }
+
+    return sum;
+}
+
+vector<int> DijkstraAdjacency(const vector<vector<Edge>>& adj, int start)
+{
+    vector<int> cost(adj.size(), INF);
+
+    // 비용, 노드
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<>> pq;
+
+    cost[start] = 0;
+    pq.push({ 0, start });
+
+    while (pq.size() > 0)
+    {
+        auto [hereCost, here] = pq.top();
+        pq.pop();
+
+        if (hereCost > cost[here])
+            continue;
+
+        for (const Edge& there : adj[here])
+        {
+            int nextCost = hereCost + there.weight;
+
+            if (nextCost < cost[there.to])
+            {
+                cost[there.to] = nextCost;
+                pq.push({ nextCost, there.to });
+            }
+        }
+    }
+
+    return cost;
+}
+
+vector<int> DijkstraCSR(const CSRGraph<int>& graph, int start)
+{
+    vector<int> cost(graph.VertexCount(), INF);
+
+    // 비용, 노드
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<>> pq;
+
+    cost[start] = 0;
+    pq.push({ 0, start });
+
+    while (pq.size() > 0)
+    {
+        auto [hereCost, here] = pq.top();
+        pq.pop();
+
+        if (hereCost > cost[here])
+            continue;
+
+        for (size_t idx = graph.Begin(here); idx < graph.End(here); idx++)
+        {
+            int to       = graph.Target(idx);
+            int nextCost = hereCost + graph.Weight(idx);
+
+            if (nextCost < cost[to])
+            {
+                cost[to] = nextCost;
+                pq.push({ nextCost, to });
+            }
+        }
+    }
+
+    return cost;
+}
+
+int main()
+{
+    vector<GraphEdge> edgeList = MakeRandomGraph(kVertexCount, kEdgeCount, kMaxWeight);
+
+    vector<vector<Edge>> adj;
+    CSRGraph<int> graph;
+
+    double adjBuild = Measure([&] {
+        adj.resize(kVertexCount);
+
+        for (const GraphEdge& edge : edgeList)
+        {
+            adj[edge.from].push_back({ edge.to, edge.weight });
+        }
+    });
+
+    double csrBuild = Measure([&] {
+        graph = CSRGraph<int>{ kVertexCount, edgeList };
+    });
+
+    int64_t adjSum = 0;
+    int64_t csrSum = 0;
+
+    double adjSweep = Measure([&] { adjSum = SweepAdjacency(adj); });
+    double csrSweep = Measure([&] { csrSum = SweepCSR(graph); });
+
+    vector<int> adjCost;
+    vector<int> csrCost;
+
+    double adjDijkstra = Measure([&] { adjCost = DijkstraAdjacency(adj, 0); });
+    double csrDijkstra = Measure([&] { csrCost = DijkstraCSR(graph, 0); });
+
+    if (adjSum != csrSum || adjCost != csrCost)
+    {
+        cout << "Mismatch!\n";
+
+        return 1;
+    }
+
+    cout << "V : " << kVertexCount << ", E : " << kEdgeCount << '\n';
+    cout << "CSR Memory : " << graph.MemoryUsage() / (1024 * 1024) << "MB\n\n";
+
+    cout << "[Build]    Adjacency : " << adjBuild    << "s, CSR : " << csrBuild    << "s\n";
+    cout << "[Sweep]    Adjacency : " << adjSweep    << "s, CSR : " << csrSweep    << "s\n";
+    cout << "[Dijkstra] Adjacency : " << adjDijkstra << "s, CSR : " << csrDijkstra << "s\n\n";
+
+    cout << "Sweep Throughput(edges/s)    Adjacency : " << kEdgeCount / adjSweep << ", CSR : " << kEdgeCount / csrSweep << '\n';
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <new>
+
+// 여러 스레드에서 동시에 갱신하는 펜윅 트리(히스토그램, 카운터 용도)
+//
+// 1. ConcurrentFenwickTree
+//    : 모든 노드를 std::atomic<int64_t>로 두고 Update()에서 fetch_add(memory_order_relaxed)를 사용한다.
+//      더하기는 순서와 상관없이 같은 결과가 나오기 때문에 다른 메모리와의 순서를 보장할 필요가 없다.
+//      대신 모든 스레드가 같은 노드(특히 2의 거듭제곱 인덱스처럼 넓은 구간을 담당하는 노드)를 건드리기 때문에
+//      스레드가 많아질수록 캐시 라인을 주고받는 비용(contention)이 커진다.
+//
+// 2. ShardedFenwickTree
+//    : 스레드(샤드)마다 자기만의 트리를 가지고 갱신은 자기 트리에만 한다.
+//      쓰는 스레드가 하나뿐이므로 fetch_add 대신 load + store만으로 충분하다(lock 접두사가 붙은 명령어가 필요 없음).
+//      조회할 때는 모든 샤드의 값을 더해야 하기 때문에 Prefix()의 비용이 샤드 개수만큼 늘어난다.
+//      갱신이 훨씬 많고 조회가 드문 경우에 적합하다.
+//
+// 두 방식 모두 Prefix()는 여러 노드를 따로 읽기 때문에 갱신 중에 호출하면 특정 시점의 스냅숏이 아닐 수 있다.
+// (갱신이 모두 끝난 다음에 읽으면 정확한 값이 나온다.)
+
+class ConcurrentFenwickTree
+{
+public:
+    explicit ConcurrentFenwickTree(size_t size)
+        : _size{ size }, _tree{ std::make_unique<std::atomic<int64_t>[]>(size + 1) }
+    { }
+
+public:
+    void Update(size_t idx, int64_t value)
+    {
+        for (idx++; idx <= _size; idx += (idx & (0 - idx)))
+        {
+            _tree[idx].fetch_add(value, std::memory_order_relaxed);
+        }
+    }
+
+    // [0, count)
+    int64_t Prefix(size_t count) const
+    {
+        int64_t ret = 0;
+
+        for (; 0 != count; count -= (count & (0 - count)))
+        {
+            ret += _tree[count].load(std::memory_order_relaxed);
+        }
+
+        return ret;
+    }
+
+    size_t Size() const { return _size; }
+
+private:
+    size_t _size;
+
+    std::unique_ptr<std::atomic<int64_t>[]> _tree;
+};
+
+class ShardedFenwickTree
+{
+    static constexpr size_t kCacheLineSize = 64;
+
+    using Node = std::atomic<int64_t>;
+
+    struct AlignedDeleter
+    {
+        void operator()(Node* ptr) const
+        {
+            ::operator delete[](ptr, std::align_val_t{ kCacheLineSize });
+        }
+    };
+
+    // 샤드의 트리 배열은 캐시 라인 경계에서 시작하고 크기도 캐시 라인 단위로 올림해서 할당한다.
+    // 그래야 서로 다른 샤드의 배열이 같은 캐시 라인을 나눠 쓰지 않는다(false sharing 방지).
+    struct Shard
+    {
+        std::unique_ptr<Node[], AlignedDeleter> tree;
+    };
+
+public:
+    ShardedFenwickTree(size_t size, int shardCount)
+        : _size{ size }, _shards(shardCount)
+    {
+        size_t bytes = ((size + 1) * sizeof(Node) + kCacheLineSize - 1) / kCacheLineSize * kCacheLineSize;
+        size_t count = bytes / sizeof(Node);
+
+        for (Shard& shard : _shards)
+        {
+            Node* tree = static_cast<Node*>(::operator new[](bytes, std::align_val_t{ kCacheLineSize }));
+
+            for (size_t idx = 0; idx < count; idx++)
+            {
+                new (&tree[idx]) Node{ 0 };
+            }
+
+            shard.tree.reset(tree);
+        }
+    }
+
+public:
+    // shard는 호출하는 스레드가 소유한 샤드의 번호이며 하나의 샤드는 하나의 스레드만 갱신해야 한다.
+    void Update(int shard, size_t idx, int64_t value)
+    {
+        Node* tree = _shards[shard].tree.get();
+
+        for (idx++; idx <= _size; idx += (idx & (0 - idx)))
+        {
+            tree[idx].store(tree[idx].load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+    }
+
+    // [0, count), 모든 샤드의 합
+    int64_t Prefix(size_t count) const
+    {
+        int64_t ret = 0;
+
+        for (const Shard& shard : _shards)
+        {
+            for (size_t idx = count; 0 != idx; idx -= (idx & (0 - idx)))
+            {
+                ret += shard.tree[idx].load(std::memory_order_relaxed);
+            }
+        }
+
+        return ret;
+    }
+
+    size_t Size() const { return _size; }
+    int ShardCount() const { return (int)_shards.size(); }
+
+private:
+    size_t _size;
+
+    std::vector<Shard> _shards;
+};
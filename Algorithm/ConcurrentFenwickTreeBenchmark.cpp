@@ -0,0 +1,160 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <latch>
+
+#include "FenwickTree.h"
+#include "ConcurrentFenwickTree.h"
+
+// ConcurrentFenwickTree.h 측정
+//
+// 스레드 개수를 1개부터 64개까지 늘려가면서 같은 개수의 갱신을 나눠서 처리하는 시간을 잰다.
+// - Mutex   : FenwickTree<int64_t> 하나를 std::mutex로 보호
+// - Atomic  : ConcurrentFenwickTree(모든 스레드가 같은 트리에 fetch_add)
+// - Sharded : ShardedFenwickTree(스레드마다 자기 샤드에만 갱신)
+//
+// 갱신이 끝난 뒤 전체 합이 갱신한 값의 합과 같은지 확인하고
+// 샤드 방식은 조회 비용이 샤드 개수에 비례하기 때문에 조회 시간도 함께 출력한다.
+//
+// 모든 스레드는 std::latch로 동시에 출발시킨다(latches_and_barriers.cpp 참고).
+// 코어 수보다 스레드가 많아지면 경합보다 문맥 교환의 영향이 커진다는 점을 감안해서 볼 것.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr size_t kBucketCount = 1 << 16;
+constexpr size_t kTotalOps    = 16'000'000;
+constexpr size_t kQueryCount  = 1'000'000;
+
+// 스레드마다 미리 만들어 둔 인덱스를 사용해서 난수 생성 비용을 빼고 잰다.
+vector<vector<uint32_t>> MakeIndices(int threadCount)
+{
+    vector<vector<uint32_t>> indices(threadCount);
+
+    for (int tid = 0; tid < threadCount; tid++)
+    {
+        mt19937 rng{ (uint32_t)tid + 1 };
+        uniform_int_distribution<uint32_t> indexDist{ 0, kBucketCount - 1 };
+
+        indices[tid].resize(kTotalOps / threadCount);
+
+        for (uint32_t& idx : indices[tid])
+        {
+            idx = indexDist(rng);
+        }
+    }
+
+    return indices;
+}
+
+// func(tid, idx)를 모든 스레드에서 실행하고 걸린 시간을 반환한다.
+template <typename Func>
+double RunThreads(const vector<vector<uint32_t>>& indices, Func&& func)
+{
+    int threadCount = (int)indices.size();
+
+    latch startLatch{ threadCount + 1 };
+
+    vector<jthread> workers;
+
+    for (int tid = 0; tid < threadCount; tid++)
+    {
+        workers.emplace_back([&, tid] {
+            startLatch.arrive_and_wait();
+
+            for (uint32_t idx : indices[tid])
+            {
+                func(tid, idx);
+            }
+        });
+    }
+
+    auto startTime = MyClock::now();
+
+    startLatch.arrive_and_wait();
+
+    workers.clear();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+template <typename Tree>
+double MeasureQuery(const Tree& tree, int64_t* checksum)
+{
+    auto startTime = MyClock::now();
+
+    for (size_t query = 0; query < kQueryCount; query++)
+    {
+        *checksum += tree.Prefix((query * 7'919) % (kBucketCount + 1));
+    }
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+int main()
+{
+    cout << "Buckets : " << kBucketCount << ", Updates : " << kTotalOps
+         << ", Hardware threads : " << thread::hardware_concurrency() << "\n\n";
+
+    for (int threads : { 1, 2, 4, 8, 16, 32, 64 })
+    {
+        vector<vector<uint32_t>> indices = MakeIndices(threads);
+
+        int64_t expected = (int64_t)(kTotalOps / threads) * threads;
+
+        FenwickTree<int64_t> locked{ kBucketCount };
+        mutex                lock;
+
+        double mutexTime = RunThreads(indices, [&](int, uint32_t idx) {
+            lock_guard<mutex> guard{ lock };
+
+            locked.Update(idx, 1);
+        });
+
+        ConcurrentFenwickTree atomicTree{ kBucketCount };
+
+        double atomicTime = RunThreads(indices, [&](int, uint32_t idx) {
+            atomicTree.Update(idx, 1);
+        });
+
+        ShardedFenwickTree shardedTree{ kBucketCount, threads };
+
+        double shardedTime = RunThreads(indices, [&](int tid, uint32_t idx) {
+            shardedTree.Update(tid, idx, 1);
+        });
+
+        bool isValid = (expected == locked.Prefix(kBucketCount))
+                    && (expected == atomicTree.Prefix(kBucketCount))
+                    && (expected == shardedTree.Prefix(kBucketCount));
+
+        int64_t atomicChecksum  = 0;
+        int64_t shardedChecksum = 0;
+
+        double atomicQueryTime  = MeasureQuery(atomicTree, &atomicChecksum);
+        double shardedQueryTime = MeasureQuery(shardedTree, &shardedChecksum);
+
+        isValid = isValid && (atomicChecksum == shardedChecksum);
+
+        cout << "Threads : " << threads
+             << ", Update(M ops/s) - Mutex : " << kTotalOps / mutexTime / 1'000'000
+             << ", Atomic : " << kTotalOps / atomicTime / 1'000'000
+             << ", Sharded : " << kTotalOps / shardedTime / 1'000'000
+             << " | Query(M ops/s) - Atomic : " << kQueryCount / atomicQueryTime / 1'000'000
+             << ", Sharded : " << kQueryCount / shardedQueryTime / 1'000'000
+             << (isValid ? "" : " (Mismatch!)") << '\n';
+    }
+
+    return 0;
+}
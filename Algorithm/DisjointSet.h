@@ -0,0 +1,246 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <utility>
+
+// 분리 집합(Disjoint Set, Union-Find)
+// : MinimumSpanningTree.cpp의 doFind(), doUnion()을 재사용할 수 있도록 옮긴 것
+//
+// MinimumSpanningTree.cpp 버전의 문제점
+// - doFind()가 재귀 함수라서 긴 체인이 만들어지면 스택 오버플로가 발생할 수 있다.
+// - doUnion()이 두 집합의 크기를 보지 않고 연결하기 때문에 트리가 한쪽으로 길어질 수 있다.
+// - 크기가 ufSet[10004]로 고정되어 있다.
+//
+// 개선 사항
+// - 크기에 의한 합치기(union by size) : 작은 집합의 루트를 큰 집합의 루트 아래에 붙인다.
+//   트리의 높이가 O(log n)을 넘지 않는다.
+// - 경로 절반(path halving) : Find()를 하면서 지나가는 정점의 부모를 조부모로 바꾼다.
+//   경로 압축(path compression)과 같은 복잡도를 가지면서 재귀나 두 번째 순회가 필요 없다.
+//   두 기법을 같이 쓰면 연산마다 사실상 상수 시간(역 아커만 함수)이다.
+//
+// CompactDisjointSet
+// : 부모 배열과 크기 배열을 int32_t 배열 하나로 합친 버전
+//   루트는 -(집합의 크기)를, 나머지는 부모의 번호를 저장한다(음수면 루트).
+//   원소당 4바이트만 사용하기 때문에 원소가 많을 때 캐시 효율이 좋아진다.
+//   대신 원소의 개수는 INT32_MAX를 넘을 수 없다.
+//
+// ConcurrentDisjointSet
+// : 여러 스레드에서 동시에 Find(), Union()을 호출할 수 있는 버전(락 없음)
+//   부모 배열을 atomic<int>로 두고 루트를 연결할 때 compare_exchange로 "아직 루트인 경우에만" 부모를 바꾼다.
+//   다른 스레드가 먼저 그 루트를 연결했다면 실패하므로 루트를 다시 찾아서 재시도한다.
+//   크기를 같이 갱신하려면 두 값을 원자적으로 바꿔야 하기 때문에 크기 대신 번호가 큰 루트를 작은 루트 아래에 붙인다.
+//   (연결 방향이 항상 일정하므로 서로를 가리키는 사이클이 생기지 않는다.)
+//   경로 절반도 compare_exchange로 처리하고 실패하면(다른 스레드가 이미 바꿈) 그냥 넘어간다.
+//   재시도 반복문을 사용하기 때문에 lock-free이지만 wait-free는 아니다.
+//   어떤 스레드의 compare_exchange가 실패했다면 다른 스레드의 Union()이 성공한 것이므로 전체는 항상 진행되지만
+//   경쟁이 심하면 특정 스레드가 재시도를 몇 번 할지는 정해져 있지 않다.
+
+class DisjointSet
+{
+public:
+    explicit DisjointSet(int count = 0)
+    {
+        this->Reset(count);
+    }
+
+public:
+    void Reset(int count)
+    {
+        _parent.resize(count);
+        _size.assign(count, 1);
+
+        for (int v = 0; v < count; v++)
+        {
+            _parent[v] = v;
+        }
+
+        _setCount = count;
+    }
+
+    int Find(int v)
+    {
+        while (v != _parent[v])
+        {
+            // 경로 절반
+            _parent[v] = _parent[_parent[v]];
+            v = _parent[v];
+        }
+
+        return v;
+    }
+
+    // 이미 같은 집합이면 false
+    bool Union(int a, int b)
+    {
+        a = this->Find(a);
+        b = this->Find(b);
+
+        if (a == b)
+            return false;
+
+        if (_size[a] < _size[b])
+        {
+            std::swap(a, b);
+        }
+
+        // 작은 집합(b)을 큰 집합(a)에 연결
+        _parent[b] = a;
+        _size[a] += _size[b];
+
+        _setCount--;
+
+        return true;
+    }
+
+    bool Same(int a, int b) { return this->Find(a) == this->Find(b); }
+
+    int SizeOf(int v) { return _size[this->Find(v)]; }
+
+    int Count() const { return (int)_parent.size(); }
+    int SetCount() const { return _setCount; }
+
+private:
+    std::vector<int> _parent;
+    std::vector<int> _size;
+
+    int _setCount = 0;
+};
+
+class CompactDisjointSet
+{
+public:
+    explicit CompactDisjointSet(int count = 0)
+    {
+        this->Reset(count);
+    }
+
+public:
+    void Reset(int count)
+    {
+        _parent.assign(count, -1);
+
+        _setCount = count;
+    }
+
+    int Find(int v)
+    {
+        while (_parent[v] >= 0)
+        {
+            int parent = _parent[v];
+
+            // 부모가 루트가 아닐 때만 조부모로 건너뛴다(루트의 값은 크기이기 때문).
+            if (_parent[parent] >= 0)
+            {
+                _parent[v] = _parent[parent];
+            }
+
+            v = _parent[v];
+        }
+
+        return v;
+    }
+
+    bool Union(int a, int b)
+    {
+        a = this->Find(a);
+        b = this->Find(b);
+
+        if (a == b)
+            return false;
+
+        // 크기는 음수로 저장되어 있기 때문에 값이 작을수록 큰 집합이다.
+        if (_parent[a] > _parent[b])
+        {
+            std::swap(a, b);
+        }
+
+        _parent[a] += _parent[b];
+        _parent[b] = a;
+
+        _setCount--;
+
+        return true;
+    }
+
+    bool Same(int a, int b) { return this->Find(a) == this->Find(b); }
+
+    int SizeOf(int v) { return -_parent[this->Find(v)]; }
+
+    int Count() const { return (int)_parent.size(); }
+    int SetCount() const { return _setCount; }
+
+private:
+    std::vector<int32_t> _parent;
+
+    int _setCount = 0;
+};
+
+class ConcurrentDisjointSet
+{
+public:
+    explicit ConcurrentDisjointSet(int count)
+        : _count{ count }, _parent{ std::make_unique<std::atomic<int>[]>(count) }
+    {
+        for (int v = 0; v < count; v++)
+        {
+            _parent[v].store(v, std::memory_order_relaxed);
+        }
+    }
+
+public:
+    int Find(int v)
+    {
+        while (true)
+        {
+            int parent = _parent[v].load(std::memory_order_acquire);
+
+            if (parent == v)
+                return v;
+
+            int grandParent = _parent[parent].load(std::memory_order_acquire);
+
+            // 경로 절반(실패해도 상관없음)
+            if (parent != grandParent)
+            {
+                _parent[v].compare_exchange_weak(parent, grandParent, std::memory_order_release, std::memory_order_relaxed);
+            }
+
+            v = grandParent;
+        }
+    }
+
+    bool Union(int a, int b)
+    {
+        while (true)
+        {
+            a = this->Find(a);
+            b = this->Find(b);
+
+            if (a == b)
+                return false;
+
+            // 번호가 큰 루트(a)를 작은 루트(b) 아래에 붙인다.
+            if (a < b)
+            {
+                std::swap(a, b);
+            }
+
+            int expected = a;
+
+            if (true == _parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel))
+                return true;
+        }
+    }
+
+    bool Same(int a, int b) { return this->Find(a) == this->Find(b); }
+
+    int Count() const { return _count; }
+
+private:
+    int _count;
+
+    std::unique_ptr<std::atomic<int>[]> _parent;
+};
@@ -0,0 +1,185 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include "DisjointSet.h"
+
+// DisjointSet.h 측정
+//
+// 1. 원소 1억 개에 무작위 Union() 1억 번
+//    - Legacy             : MinimumSpanningTree.cpp의 예전 방식(재귀 경로 압축, 크기를 보지 않고 연결)
+//    - DisjointSet        : 크기에 의한 합치기 + 경로 절반
+//    - CompactDisjointSet : 위와 같지만 원소당 4바이트
+// 2. 긴 체인 : 예전 방식으로 연결하면 트리가 일자로 길어지는 순서로 Union()을 호출한 다음 Find()를 호출한다.
+//    예전 방식은 재귀 깊이가 원소 개수만큼 깊어져서 스택 오버플로가 발생하기 때문에 새 버전만 실행한다.
+//
+// 모든 방식이 같은 난수열을 사용하도록 간단한 xorshift를 직접 돌린다.
+// 합쳐진 횟수와 남은 집합의 개수가 모두 같아야 한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int    kCount      = 100'000'000;
+constexpr size_t kUnionCount = 100'000'000;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// 비교용 : 예전 방식
+class LegacyDisjointSet
+{
+public:
+    explicit LegacyDisjointSet(int count)
+        : _parent(count)
+    {
+        for (int v = 0; v < count; v++)
+        {
+            _parent[v] = v;
+        }
+    }
+
+public:
+    int Find(int here)
+    {
+        if (here == _parent[here])
+            return here;
+
+        _parent[here] = this->Find(_parent[here]);
+
+        return _parent[here];
+    }
+
+    bool Union(int a, int b)
+    {
+        a = this->Find(a);
+        b = this->Find(b);
+
+        if (a == b)
+            return false;
+
+        _parent[b] = a;
+
+        return true;
+    }
+
+private:
+    vector<int> _parent;
+};
+
+struct XorShift
+{
+    uint64_t state;
+
+    int Next(int bound)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        return (int)(state % (uint64_t)bound);
+    }
+};
+
+template <typename Set>
+size_t RandomUnions(Set& set)
+{
+    XorShift rng{ 88'172'645'463'325'252ull };
+
+    size_t merged = 0;
+
+    for (size_t op = 0; op < kUnionCount; op++)
+    {
+        int a = rng.Next(kCount);
+        int b = rng.Next(kCount);
+
+        merged += set.Union(a, b);
+    }
+
+    return merged;
+}
+
+template <typename Set>
+void RunChain(const char* name)
+{
+    constexpr int kChainLength = 10'000'000;
+
+    Set set{ kChainLength };
+
+    int root = -1;
+
+    double elapsed = Measure([&] {
+        // 예전 방식이라면 (i + 1)의 루트가 i의 루트 아래로 들어가서 일자 트리가 된다.
+        for (int v = kChainLength - 1; v > 0; v--)
+        {
+            set.Union(v - 1, v);
+        }
+
+        root = set.Find(kChainLength - 1);
+    });
+
+    cout << name << " chain : " << elapsed << "s, set size : " << set.SizeOf(root) << '\n';
+}
+
+int main()
+{
+    cout << "Elements : " << kCount << ", Unions : " << kUnionCount << '\n';
+
+    size_t legacyMerged  = 0;
+    size_t merged        = 0;
+    size_t compactMerged = 0;
+
+    int setCount        = 0;
+    int compactSetCount = 0;
+
+    {
+        LegacyDisjointSet set{ kCount };
+
+        double elapsed = Measure([&] { legacyMerged = RandomUnions(set); });
+
+        cout << "Legacy             : " << elapsed << "s, " << sizeof(int) << " bytes/element\n";
+    }
+
+    {
+        DisjointSet set{ kCount };
+
+        double elapsed = Measure([&] { merged = RandomUnions(set); });
+
+        setCount = set.SetCount();
+
+        cout << "DisjointSet        : " << elapsed << "s, " << sizeof(int) * 2 << " bytes/element\n";
+    }
+
+    {
+        CompactDisjointSet set{ kCount };
+
+        double elapsed = Measure([&] { compactMerged = RandomUnions(set); });
+
+        compactSetCount = set.SetCount();
+
+        cout << "CompactDisjointSet : " << elapsed << "s, " << sizeof(int32_t) << " bytes/element\n";
+    }
+
+    bool isValid = (legacyMerged == merged) && (merged == compactMerged) && (setCount == compactSetCount)
+                && ((size_t)kCount - merged == (size_t)setCount);
+
+    cout << "Merged : " << merged << ", Sets : " << setCount << (isValid ? "" : " (Mismatch!)") << "\n\n";
+
+    RunChain<DisjointSet>("DisjointSet       ");
+    RunChain<CompactDisjointSet>("CompactDisjointSet");
+
+    return 0;
+}
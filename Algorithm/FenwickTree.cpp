@@ -1,5 +1,7 @@
 #include <bits/stdc++.h>
 
+#include "FenwickTree.h"
+
 using namespace std;
 
 // 펜윅트리
@@ -24,6 +26,8 @@ using namespace std;
 // }
 
 // 문제) 백준 2042번 : 구간 합 구하기
+// 트리 구현은 FenwickTree.h로 옮겼다(인덱스는 0부터 시작, O(n) 생성).
+// 예전 전역 배열 버전의 update()와 sum()은 각각 Update()와 Prefix()에 해당한다.
 
 int n;
 int m;
@@ -33,31 +37,6 @@ int a;
 int b;
 int64_t c;
 
-int64_t arr[1'000'004];
-int64_t tree[1'000'004];
-
-void update(int idx, int64_t amount)
-{
-    while (idx <= n)
-    {
-        tree[idx] += amount;
-        idx += (idx & -idx);
-    }
-}
-
-int64_t sum(int idx)
-{
-    int64_t ret = 0;
-
-    while (0 != idx)
-    {
-        ret += tree[idx];
-        idx -= (idx & -idx);
-    }
-
-    return ret;
-}
-
 int main()
 {
     ios_base::sync_with_stdio(false);
@@ -66,27 +45,29 @@ int main()
 
     cin >> n >> m >> k;
 
-    for (int i = 1; i <= n; i++)
+    vector<int64_t> arr(n);
+
+    for (int i = 0; i < n; i++)
     {
         cin >> arr[i];
-
-        update(i, arr[i]);
     }
 
+    FenwickTree<int64_t> tree{ arr };
+
     for (int i = 0; i < m + k; i++)
     {
         cin >> a >> b >> c;
 
         if (1 == a)
         {
-            int64_t amount = c - arr[b];
-            arr[b] = c;
+            int64_t amount = c - arr[b - 1];
+            arr[b - 1] = c;
 
-            update(b, amount);
+            tree.Update(b - 1, amount);
         }
         else if (2 == a)
         {
-            cout << sum(c) - sum(b - 1) << '\n';
+            cout << tree.Range(b - 1, c) << '\n';
         }
     }
 
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <span>
+#include <bit>
+#include <functional>
+#include <type_traits>
+
+// 범용 펜윅 트리(FenwickTree.cpp의 전역 배열 버전을 클래스로 옮긴 것)
+//
+// 외부에서 사용하는 인덱스는 [0, n)이고 내부 배열은 FenwickTree.cpp와 같이 1부터 시작한다.
+// - Update(idx, value) : arr[idx] = Op(arr[idx], value)
+// - Prefix(count)      : Op(arr[0], ..., arr[count - 1])
+//
+// Op는 결합 법칙과 교환 법칙을 만족해야 한다(std::plus, 값이 커지기만 하는 경우의 max 등).
+// 구간 [left, right)의 값은 역연산이 필요하기 때문에 Op가 std::plus일 때만 Range()를 제공한다.
+//
+// O(n) 생성
+// : update()를 n번 호출하면 O(n log n)이지만
+//   각 노드의 값을 자기 자신의 부모(idx + (idx & -idx))에 한 번씩만 더해주면 O(n)에 만들 수 있다.
+//   작은 인덱스부터 처리하면 부모에 더하는 시점에 자기 자신의 구간 값은 이미 완성되어 있다.
+//
+// LowerBound(value)
+// : Prefix(idx + 1) >= value를 만족하는 가장 작은 idx를 찾는다(없으면 Size()).
+//   누적 값이 단조 증가해야 하므로 std::plus라면 모든 값이 0 이상이어야 한다.
+//   이분 탐색 + Prefix()는 O(log^2 n)이지만 트리의 구조를 따라 가장 큰 2의 거듭제곱부터 내려가면(binary lifting) O(log n)이다.
+//   노드 (pos + step)은 (pos, pos + step] 구간을 담당하기 때문에 누적 값이 value보다 작을 때만 step만큼 전진한다.
+//   빈도수를 저장해 두면 k번째 원소 찾기(order statistics)가 된다.
+//
+// 자주 다시 만드는 경우를 위해 Build()는 기존에 할당한 메모리를 재사용한다.
+
+template <typename T, typename Op = std::plus<T>>
+class FenwickTree
+{
+public:
+    // identity : Op의 항등원(std::plus라면 0)
+    explicit FenwickTree(size_t size = 0, T identity = T{}, Op op = Op{})
+        : _identity{ identity }, _op{ op }
+    {
+        this->Reset(size);
+    }
+
+    explicit FenwickTree(std::span<const T> values, T identity = T{}, Op op = Op{})
+        : _identity{ identity }, _op{ op }
+    {
+        this->Build(values);
+    }
+
+public:
+    // 크기를 바꾸고 모든 값을 항등원으로 초기화한다.
+    void Reset(size_t size)
+    {
+        _tree.assign(size + 1, _identity);
+
+        this->updateTopStep();
+    }
+
+    // O(n)
+    void Build(std::span<const T> values)
+    {
+        size_t size = values.size();
+
+        _tree.resize(size + 1);
+        _tree[0] = _identity;
+
+        for (size_t idx = 1; idx <= size; idx++)
+        {
+            _tree[idx] = values[idx - 1];
+        }
+
+        for (size_t idx = 1; idx <= size; idx++)
+        {
+            size_t parent = idx + (idx & (0 - idx));
+
+            if (parent <= size)
+            {
+                _tree[parent] = _op(_tree[parent], _tree[idx]);
+            }
+        }
+
+        this->updateTopStep();
+    }
+
+    void Update(size_t idx, T value)
+    {
+        for (idx++; idx < _tree.size(); idx += (idx & (0 - idx)))
+        {
+            _tree[idx] = _op(_tree[idx], value);
+        }
+    }
+
+    // [0, count)
+    T Prefix(size_t count) const
+    {
+        T ret = _identity;
+
+        for (; 0 != count; count -= (count & (0 - count)))
+        {
+            ret = _op(ret, _tree[count]);
+        }
+
+        return ret;
+    }
+
+    // [left, right)
+    T Range(size_t left, size_t right) const requires std::is_same_v<Op, std::plus<T>>
+    {
+        return this->Prefix(right) - this->Prefix(left);
+    }
+
+    size_t LowerBound(T value) const
+    {
+        size_t pos = 0;
+        T      acc = _identity;
+
+        for (size_t step = _topStep; 0 != step; step >>= 1)
+        {
+            size_t next = pos + step;
+
+            if (next < _tree.size() && _op(acc, _tree[next]) < value)
+            {
+                pos = next;
+                acc = _op(acc, _tree[next]);
+            }
+        }
+
+        // pos는 누적 값이 value보다 작은 마지막 위치(1부터 시작)이므로 0부터 시작하는 인덱스로는 그대로 답이 된다.
+        return pos;
+    }
+
+    size_t Size() const { return _tree.size() - 1; }
+
+private:
+    void updateTopStep()
+    {
+        _topStep = std::bit_floor(this->Size());
+    }
+
+private:
+    std::vector<T> _tree;
+
+    T  _identity;
+    Op _op;
+
+    size_t _topStep = 0; // Size() 이하의 가장 큰 2의 거듭제곱
+};
+
+// 구간 갱신 + 구간 합(Range update, Range query)
+//
+// 구간 [left, right)에 value를 더하면 i < count인 원소의 합(Prefix(count))은 다음과 같이 바뀐다.
+// - count <= left         : 변화 없음
+// - left < count <= right : value * (count - left)
+// - right < count         : value * (right - left)
+//
+// 따라서 두 개의 펜윅 트리 B1, B2를 두고
+// B1[left] += value, B1[right] -= value
+// B2[left] += value * left, B2[right] -= value * right
+// 로 갱신하면 Prefix(count) = B1.Prefix(count) * count - B2.Prefix(count)가 된다.
+//
+// 두 트리는 항상 같은 인덱스를 같은 순서로 방문하기 때문에 배열 하나에 {B1, B2} 쌍으로 붙여서 저장한다.
+// 이러면 한 번의 순회로 두 값을 같이 읽고 쓰며 캐시 미스도 절반으로 줄어든다.
+template <typename T>
+class RangeFenwickTree
+{
+    struct Node
+    {
+        T b1{};
+        T b2{};
+    };
+
+public:
+    explicit RangeFenwickTree(size_t size = 0)
+    {
+        this->Reset(size);
+    }
+
+public:
+    void Reset(size_t size)
+    {
+        _tree.assign(size + 1, Node{});
+    }
+
+    // [left, right)의 모든 원소에 value를 더한다.
+    void Add(size_t left, size_t right, T value)
+    {
+        this->update(left, value, value * (T)left);
+        this->update(right, -value, -value * (T)right);
+    }
+
+    // [0, count)
+    T Prefix(size_t count) const
+    {
+        T b1{};
+        T b2{};
+
+        for (size_t idx = count; 0 != idx; idx -= (idx & (0 - idx)))
+        {
+            b1 += _tree[idx].b1;
+            b2 += _tree[idx].b2;
+        }
+
+        return b1 * (T)count - b2;
+    }
+
+    // [left, right)
+    T Range(size_t left, size_t right) const
+    {
+        return this->Prefix(right) - this->Prefix(left);
+    }
+
+    size_t Size() const { return _tree.size() - 1; }
+
+private:
+    void update(size_t idx, T b1, T b2)
+    {
+        for (idx++; idx < _tree.size(); idx += (idx & (0 - idx)))
+        {
+            _tree[idx].b1 += b1;
+            _tree[idx].b2 += b2;
+        }
+    }
+
+private:
+    std::vector<Node> _tree;
+};
+
+// 2차원 펜윅 트리(2D 누적 합)
+//
+// 행 방향의 펜윅 트리의 각 노드가 열 방향의 펜윅 트리를 가진 형태이다.
+// vector<vector<T>>로 만들면 행마다 따로 할당되어 메모리가 흩어지기 때문에
+// (rows + 1) * (cols + 1) 크기의 배열 하나에 행 우선(row-major)으로 저장한다.
+// 안쪽 반복문은 열 방향이라 같은 행 안에서 이동하고 바깥 반복문이 행을 건너뛴다.
+//
+// Build()는 1차원과 같은 방식을 열 방향으로 한 번, 행 방향으로 한 번 적용해서 O(rows * cols)에 만든다.
+// 행 방향 단계는 행 전체를 부모 행에 더하는 것이라 연속된 메모리를 순서대로 처리하게 된다.
+template <typename T>
+class FenwickTree2D
+{
+public:
+    FenwickTree2D(size_t rows = 0, size_t cols = 0)
+    {
+        this->Reset(rows, cols);
+    }
+
+public:
+    void Reset(size_t rows, size_t cols)
+    {
+        _rows   = rows;
+        _cols   = cols;
+        _stride = cols + 1;
+
+        _tree.assign((rows + 1) * _stride, T{});
+    }
+
+    // values : rows * cols 크기의 행 우선 배열
+    void Build(std::span<const T> values, size_t rows, size_t cols)
+    {
+        this->Reset(rows, cols);
+
+        for (size_t row = 1; row <= rows; row++)
+        {
+            T*       dst = &_tree[row * _stride];
+            const T* src = &values[(row - 1) * cols];
+
+            for (size_t col = 1; col <= cols; col++)
+            {
+                dst[col] += src[col - 1];
+
+                size_t parent = col + (col & (0 - col));
+
+                if (parent <= cols)
+                {
+                    dst[parent] += dst[col];
+                }
+            }
+        }
+
+        for (size_t row = 1; row <= rows; row++)
+        {
+            size_t parent = row + (row & (0 - row));
+
+            if (parent > rows)
+                continue;
+
+            T*       dst = &_tree[parent * _stride];
+            const T* src = &_tree[row * _stride];
+
+            for (size_t col = 1; col <= cols; col++)
+            {
+                dst[col] += src[col];
+            }
+        }
+    }
+
+    void Update(size_t row, size_t col, T value)
+    {
+        for (size_t r = row + 1; r <= _rows; r += (r & (0 - r)))
+        {
+            T* line = &_tree[r * _stride];
+
+            for (size_t c = col + 1; c <= _cols; c += (c & (0 - c)))
+            {
+                line[c] += value;
+            }
+        }
+    }
+
+    // [0, rows) x [0, cols)
+    T Prefix(size_t rows, size_t cols) const
+    {
+        T ret{};
+
+        for (size_t r = rows; 0 != r; r -= (r & (0 - r)))
+        {
+            const T* line = &_tree[r * _stride];
+
+            for (size_t c = cols; 0 != c; c -= (c & (0 - c)))
+            {
+                ret += line[c];
+            }
+        }
+
+        return ret;
+    }
+
+    // [top, bottom) x [left, right)
+    T Range(size_t top, size_t left, size_t bottom, size_t right) const
+    {
+        return this->Prefix(bottom, right) - this->Prefix(top, right) - this->Prefix(bottom, left) + this->Prefix(top, left);
+    }
+
+    size_t Rows() const { return _rows; }
+    size_t Cols() const { return _cols; }
+
+private:
+    std::vector<T> _tree;
+
+    size_t _rows   = 0;
+    size_t _cols   = 0;
+    size_t _stride = 1;
+};
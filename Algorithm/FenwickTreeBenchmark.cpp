@@ -0,0 +1,141 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+#include "FenwickTree.h"
+
+// FenwickTree.h 측정
+//
+// 1. 생성 : Update()를 n번 호출(O(n log n)) vs Build()(O(n))
+// 2. k번째 원소 찾기 : Prefix()를 이용한 이분 탐색(O(log^2 n)) vs LowerBound()(O(log n))
+// 3. Op를 바꿔서 사용하는 예(누적 최댓값)
+//
+// 결과가 서로 일치하는지도 함께 확인한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr size_t kSize       = 10'000'000;
+constexpr size_t kQueryCount = 1'000'000;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+struct Max
+{
+    int64_t operator()(int64_t lhs, int64_t rhs) const { return max(lhs, rhs); }
+};
+
+int main()
+{
+    mt19937 rng{ 1 };
+    uniform_int_distribution<int64_t> valueDist{ 0, 100 };
+
+    // 값마다 등장한 횟수(빈도수)
+    vector<int64_t> counts(kSize);
+
+    for (int64_t& count : counts)
+    {
+        count = valueDist(rng);
+    }
+
+    FenwickTree<int64_t> byUpdate{ kSize };
+    FenwickTree<int64_t> byBuild;
+
+    double updateTime = Measure([&] {
+        for (size_t idx = 0; idx < kSize; idx++)
+        {
+            byUpdate.Update(idx, counts[idx]);
+        }
+    });
+
+    double buildTime = Measure([&] { byBuild.Build(counts); });
+
+    bool isSame = true;
+
+    for (size_t count = 0; count <= kSize; count += 9'973)
+    {
+        isSame = isSame && (byUpdate.Prefix(count) == byBuild.Prefix(count));
+    }
+
+    cout << "n : " << kSize << '\n';
+    cout << "Build by Update() : " << updateTime << "s\n";
+    cout << "Build()           : " << buildTime << "s" << (isSame ? "" : " (Mismatch!)") << "\n\n";
+
+    // k번째 원소(0부터 시작)가 속한 값을 찾는다.
+    int64_t total = byBuild.Prefix(kSize);
+
+    uniform_int_distribution<int64_t> rankDist{ 1, total };
+
+    vector<int64_t> ranks(kQueryCount);
+
+    for (int64_t& rank : ranks)
+    {
+        rank = rankDist(rng);
+    }
+
+    vector<size_t> bySearch(kQueryCount);
+    vector<size_t> byLifting(kQueryCount);
+
+    double searchTime = Measure([&] {
+        for (size_t query = 0; query < kQueryCount; query++)
+        {
+            // Prefix(idx + 1) >= rank를 만족하는 가장 작은 idx
+            size_t low  = 0;
+            size_t high = kSize;
+
+            while (low < high)
+            {
+                size_t mid = (low + high) / 2;
+
+                if (byBuild.Prefix(mid + 1) < ranks[query])
+                {
+                    low = mid + 1;
+                }
+                else
+                {
+                    high = mid;
+                }
+            }
+
+            bySearch[query] = low;
+        }
+    });
+
+    double liftingTime = Measure([&] {
+        for (size_t query = 0; query < kQueryCount; query++)
+        {
+            byLifting[query] = byBuild.LowerBound(ranks[query]);
+        }
+    });
+
+    cout << "Queries : " << kQueryCount << '\n';
+    cout << "Binary search + Prefix() : " << searchTime << "s\n";
+    cout << "LowerBound()             : " << liftingTime << "s" << (bySearch == byLifting ? "" : " (Mismatch!)") << "\n\n";
+
+    // 누적 최댓값(값이 커지기만 하는 경우)
+    FenwickTree<int64_t, Max> prefixMax{ counts, numeric_limits<int64_t>::lowest() };
+
+    int64_t expected = *max_element(counts.begin(), counts.begin() + kSize / 2);
+
+    cout << "Prefix max : " << prefixMax.Prefix(kSize / 2) << (expected == prefixMax.Prefix(kSize / 2) ? "" : " (Mismatch!)") << '\n';
+
+    return 0;
+}
@@ -0,0 +1,314 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "FenwickTree.h"
+
+// FenwickTree.h의 RangeFenwickTree, FenwickTree2D 측정
+//
+// 1. RangeFenwickTree : 구간 갱신과 구간 합의 처리량(작은 크기에서는 단순 배열과 결과 비교)
+// 2. FenwickTree2D    : 4096 x 4096 격자(히트맵)에서 점 갱신과 사각형 구간 합의 처리량
+//                       vector<vector<T>>로 만든 2D 펜윅 트리와 비교하고 2D 누적 합 배열로 결과를 검증한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr size_t kGridSize = 4'096;
+constexpr size_t kOpCount  = 1'000'000;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// 비교용 : 행마다 따로 할당하는 2D 펜윅 트리
+class NestedFenwickTree2D
+{
+public:
+    NestedFenwickTree2D(size_t rows, size_t cols)
+        : _tree(rows + 1, vector<int64_t>(cols + 1, 0))
+    { }
+
+public:
+    void Update(size_t row, size_t col, int64_t value)
+    {
+        for (size_t r = row + 1; r < _tree.size(); r += (r & (0 - r)))
+        {
+            for (size_t c = col + 1; c < _tree[r].size(); c += (c & (0 - c)))
+            {
+                _tree[r][c] += value;
+            }
+        }
+    }
+
+    int64_t Prefix(size_t rows, size_t cols) const
+    {
+        int64_t ret = 0;
+
+        for (size_t r = rows; 0 != r; r -= (r & (0 - r)))
+        {
+            for (size_t c = cols; 0 != c; c -= (c & (0 - c)))
+            {
+                ret += _tree[r][c];
+            }
+        }
+
+        return ret;
+    }
+
+    int64_t Range(size_t top, size_t left, size_t bottom, size_t right) const
+    {
+        return this->Prefix(bottom, right) - this->Prefix(top, right) - this->Prefix(bottom, left) + this->Prefix(top, left);
+    }
+
+private:
+    vector<vector<int64_t>> _tree;
+};
+
+struct Rect
+{
+    size_t top;
+    size_t left;
+    size_t bottom;
+    size_t right;
+};
+
+void RunRangeFenwick(mt19937& rng)
+{
+    // 작은 크기에서 단순 배열과 비교
+    {
+        constexpr size_t kSize = 1'000;
+
+        RangeFenwickTree<int64_t> tree{ kSize };
+        vector<int64_t>           naive(kSize, 0);
+
+        uniform_int_distribution<size_t>  indexDist{ 0, kSize };
+        uniform_int_distribution<int64_t> valueDist{ -1'000, 1'000 };
+
+        bool isValid = true;
+
+        for (int op = 0; op < 10'000; op++)
+        {
+            size_t left  = indexDist(rng);
+            size_t right = indexDist(rng);
+
+            if (left > right)
+            {
+                swap(left, right);
+            }
+
+            if (0 == op % 2)
+            {
+                int64_t value = valueDist(rng);
+
+                tree.Add(left, right, value);
+
+                for (size_t idx = left; idx < right; idx++)
+                {
+                    naive[idx] += value;
+                }
+            }
+            else
+            {
+                int64_t expected = 0;
+
+                for (size_t idx = left; idx < right; idx++)
+                {
+                    expected += naive[idx];
+                }
+
+                isValid = isValid && (expected == tree.Range(left, right));
+            }
+        }
+
+        cout << "RangeFenwickTree validation : " << (isValid ? "OK" : "Mismatch!") << '\n';
+    }
+
+    constexpr size_t kSize = kGridSize * kGridSize;
+
+    RangeFenwickTree<int64_t> tree{ kSize };
+
+    uniform_int_distribution<size_t>  indexDist{ 0, kSize };
+    uniform_int_distribution<int64_t> valueDist{ -1'000, 1'000 };
+
+    vector<pair<size_t, size_t>> ranges(kOpCount);
+
+    for (auto& [left, right] : ranges)
+    {
+        left  = indexDist(rng);
+        right = indexDist(rng);
+
+        if (left > right)
+        {
+            swap(left, right);
+        }
+    }
+
+    double addTime = Measure([&] {
+        for (auto [left, right] : ranges)
+        {
+            tree.Add(left, right, valueDist(rng));
+        }
+    });
+
+    int64_t checksum = 0;
+
+    double queryTime = Measure([&] {
+        for (auto [left, right] : ranges)
+        {
+            checksum += tree.Range(left, right);
+        }
+    });
+
+    cout << "n : " << kSize
+         << ", Add : " << kOpCount / addTime / 1'000'000 << "M ops/s"
+         << ", Range : " << kOpCount / queryTime / 1'000'000 << "M ops/s"
+         << " (checksum : " << checksum << ")\n\n";
+}
+
+void RunFenwick2D(mt19937& rng)
+{
+    uniform_int_distribution<int64_t> valueDist{ 0, 100 };
+    uniform_int_distribution<size_t>  cellDist{ 0, kGridSize - 1 };
+    uniform_int_distribution<size_t>  edgeDist{ 0, kGridSize };
+
+    vector<int64_t> heatmap(kGridSize * kGridSize);
+
+    for (int64_t& value : heatmap)
+    {
+        value = valueDist(rng);
+    }
+
+    // 검증용 2D 누적 합
+    vector<int64_t> prefix((kGridSize + 1) * (kGridSize + 1), 0);
+
+    for (size_t row = 0; row < kGridSize; row++)
+    {
+        for (size_t col = 0; col < kGridSize; col++)
+        {
+            prefix[(row + 1) * (kGridSize + 1) + col + 1] = heatmap[row * kGridSize + col]
+                + prefix[row * (kGridSize + 1) + col + 1]
+                + prefix[(row + 1) * (kGridSize + 1) + col]
+                - prefix[row * (kGridSize + 1) + col];
+        }
+    }
+
+    vector<Rect> rects(kOpCount);
+
+    for (Rect& rect : rects)
+    {
+        rect = { edgeDist(rng), edgeDist(rng), edgeDist(rng), edgeDist(rng) };
+
+        if (rect.top > rect.bottom)
+        {
+            swap(rect.top, rect.bottom);
+        }
+
+        if (rect.left > rect.right)
+        {
+            swap(rect.left, rect.right);
+        }
+    }
+
+    FenwickTree2D<int64_t> flat;
+    NestedFenwickTree2D    nested{ kGridSize, kGridSize };
+
+    double buildTime = Measure([&] { flat.Build(heatmap, kGridSize, kGridSize); });
+
+    double nestedBuildTime = Measure([&] {
+        for (size_t row = 0; row < kGridSize; row++)
+        {
+            for (size_t col = 0; col < kGridSize; col++)
+            {
+                nested.Update(row, col, heatmap[row * kGridSize + col]);
+            }
+        }
+    });
+
+    bool isValid = true;
+
+    for (size_t idx = 0; idx < 10'000; idx++)
+    {
+        const Rect& rect = rects[idx];
+
+        int64_t expected = prefix[rect.bottom * (kGridSize + 1) + rect.right]
+            - prefix[rect.top * (kGridSize + 1) + rect.right]
+            - prefix[rect.bottom * (kGridSize + 1) + rect.left]
+            + prefix[rect.top * (kGridSize + 1) + rect.left];
+
+        isValid = isValid && (expected == flat.Range(rect.top, rect.left, rect.bottom, rect.right))
+                          && (expected == nested.Range(rect.top, rect.left, rect.bottom, rect.right));
+    }
+
+    cout << "Grid : " << kGridSize << " x " << kGridSize << (isValid ? "" : " (Mismatch!)") << '\n';
+    cout << "Build  - Flat Build() : " << buildTime << "s, Nested (Update() per cell) : " << nestedBuildTime << "s\n";
+
+    vector<pair<size_t, size_t>> cells(kOpCount);
+
+    for (auto& [row, col] : cells)
+    {
+        row = cellDist(rng);
+        col = cellDist(rng);
+    }
+
+    double flatUpdateTime = Measure([&] {
+        for (auto [row, col] : cells)
+        {
+            flat.Update(row, col, 1);
+        }
+    });
+
+    double nestedUpdateTime = Measure([&] {
+        for (auto [row, col] : cells)
+        {
+            nested.Update(row, col, 1);
+        }
+    });
+
+    int64_t flatChecksum   = 0;
+    int64_t nestedChecksum = 0;
+
+    double flatQueryTime = Measure([&] {
+        for (const Rect& rect : rects)
+        {
+            flatChecksum += flat.Range(rect.top, rect.left, rect.bottom, rect.right);
+        }
+    });
+
+    double nestedQueryTime = Measure([&] {
+        for (const Rect& rect : rects)
+        {
+            nestedChecksum += nested.Range(rect.top, rect.left, rect.bottom, rect.right);
+        }
+    });
+
+    cout << "Update - Flat : " << kOpCount / flatUpdateTime / 1'000'000 << "M ops/s"
+         << ", Nested : " << kOpCount / nestedUpdateTime / 1'000'000 << "M ops/s\n";
+
+    cout << "Query  - Flat : " << kOpCount / flatQueryTime / 1'000'000 << "M ops/s"
+         << ", Nested : " << kOpCount / nestedQueryTime / 1'000'000 << "M ops/s"
+         << (flatChecksum == nestedChecksum ? "" : " (Mismatch!)") << '\n';
+}
+
+int main()
+{
+    mt19937 rng{ 1 };
+
+    RunRangeFenwick(rng);
+    RunFenwick2D(rng);
+
+    return 0;
+}
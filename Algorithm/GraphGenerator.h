@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "CSRGraph.h"
+
+// 벤치마크용 그래프 생성 함수 모음
+// 같은 시드를 넣으면 항상 같은 그래프가 나오기 때문에 구현 간 비교를 할 때 사용하면 좋다.
+
+using GraphEdge = CSRGraph<int>::Edge;
+
+// 균등 분포 랜덤 그래프
+// : 정점 0에서 모든 정점으로 도달할 수 있도록 (i - 1) -> i 형태의 경로를 먼저 깔아둔다.
+inline std::vector<GraphEdge> MakeRandomGraph(int vertexCount, size_t edgeCount, int maxWeight, uint32_t seed = 1)
+{
+    std::mt19937 rng{ seed };
+    std::uniform_int_distribution<int> vertexDist{ 0, vertexCount - 1 };
+    std::uniform_int_distribution<int> weightDist{ 1, maxWeight };
+
+    std::vector<GraphEdge> edges;
+    edges.reserve(edgeCount);
+
+    for (int v = 1; v < vertexCount && edges.size() < edgeCount; v++)
+    {
+        edges.push_back({ v - 1, v, weightDist(rng) });
+    }
+
+    while (edges.size() < edgeCount)
+    {
+        edges.push_back({ vertexDist(rng), vertexDist(rng), weightDist(rng) });
+    }
+
+    return edges;
+}
+
+// 음의 사이클이 없는 음의 가중치 그래프
+// : MakeRandomGraph()로 만든 그래프의 정점마다 임의의 포텐셜 p(v)를 두고 w'(u, v) = w(u, v) + p(u) - p(v)로 가중치를 바꾼다.
+//   어떤 사이클이든 포텐셜은 상쇄되기 때문에 사이클의 가중치 합은 원래 그래프(양수)와 같다.
+inline std::vector<GraphEdge> MakeNegativeWeightGraph(int vertexCount, size_t edgeCount, uint32_t seed = 1)
+{
+    std::vector<GraphEdge> edges = MakeRandomGraph(vertexCount, edgeCount, 1'000, seed);
+
+    std::mt19937 rng{ seed };
+    std::uniform_int_distribution<int> potentialDist{ 0, 500 };
+
+    std::vector<int> potential(vertexCount);
+
+    for (int& p : potential)
+    {
+        p = potentialDist(rng);
+    }
+
+    for (GraphEdge& edge : edges)
+    {
+        edge.weight += potential[edge.from] - potential[edge.to];
+    }
+
+    return edges;
+}
+
+// 격자 그래프(도로망과 비슷한 형태)
+// : 정점 (x, y)의 번호는 y * width + x이며 상하좌우로 양방향 간선을 가진다.
+inline std::vector<GraphEdge> MakeGridGraph(int width, int height, int maxWeight, uint32_t seed = 1)
+{
+    std::mt19937 rng{ seed };
+    std::uniform_int_distribution<int> weightDist{ 1, maxWeight };
+
+    std::vector<GraphEdge> edges;
+    edges.reserve((size_t)width * height * 4);
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int here = y * width + x;
+
+            if (x + 1 < width)
+            {
+                int weight = weightDist(rng);
+
+                edges.push_back({ here, here + 1, weight });
+                edges.push_back({ here + 1, here, weight });
+            }
+
+            if (y + 1 < height)
+            {
+                int weight = weightDist(rng);
+
+                edges.push_back({ here, here + width, weight });
+                edges.push_back({ here + width, here, weight });
+            }
+        }
+    }
+
+    return edges;
+}
+
+// 멱법칙(Power-law) 분포를 흉내낸 그래프
+// : 번호가 작은 정점일수록 높은 확률로 선택되게 해서 소수의 허브 정점에 간선이 몰리게 만든다.
+//   (0, 1) 구간의 균등 분포 값 u에 대해 V * u^skew를 정점 번호로 사용하는 단순한 방식이다.
+inline std::vector<GraphEdge> MakePowerLawGraph(int vertexCount, size_t edgeCount, int maxWeight, double skew = 3.0, uint32_t seed = 1)
+{
+    std::mt19937 rng{ seed };
+    std::uniform_real_distribution<double> realDist{ 0.0, 1.0 };
+    std::uniform_int_distribution<int> weightDist{ 1, maxWeight };
+
+    auto pickVertex = [&]() {
+        int v = (int)(vertexCount * std::pow(realDist(rng), skew));
+
+        return v < vertexCount ? v : vertexCount - 1;
+    };
+
+    std::vector<GraphEdge> edges;
+    edges.reserve(edgeCount);
+
+    for (int v = 1; v < vertexCount && edges.size() < edgeCount; v++)
+    {
+        edges.push_back({ v - 1, v, weightDist(rng) });
+    }
+
+    while (edges.size() < edgeCount)
+    {
+        edges.push_back({ pickVertex(), pickVertex(), weightDist(rng) });
+    }
+
+    return edges;
+}
+
+// 유향 비순환 그래프(DAG)
+// : 정점 번호를 무작위로 섞은 순서를 정해 두고 그 순서에서 앞에 있는 정점 -> 뒤에 있는 정점으로만 간선을 만든다.
+//   span은 간선이 건너뛸 수 있는 최대 거리(순서 기준)이며 작을수록 긴 경로가 많아진다.
+//   span이 1이면 모든 정점이 한 줄로 이어진 체인이 된다(edgeCount는 무시함).
+inline std::vector<GraphEdge> MakeRandomDag(int vertexCount, size_t edgeCount, int span, uint32_t seed = 1)
+{
+    std::vector<GraphEdge> edges;
+
+    // 간선을 만들려면 정점이 두 개 이상 있어야 하고 span은 1 이상이어야 한다.
+    if (vertexCount < 2 || span < 1)
+        return edges;
+
+    std::mt19937 rng{ seed };
+    std::uniform_int_distribution<int> rankDist{ 0, vertexCount - 2 };
+
+    std::vector<int> vertexAt(vertexCount);
+
+    for (int rank = 0; rank < vertexCount; rank++)
+    {
+        vertexAt[rank] = rank;
+    }
+
+    std::shuffle(vertexAt.begin(), vertexAt.end(), rng);
+
+    if (1 == span)
+    {
+        edges.reserve(vertexCount - 1);
+
+        for (int rank = 1; rank < vertexCount; rank++)
+        {
+            edges.push_back({ vertexAt[rank - 1], vertexAt[rank], 1 });
+        }
+
+        return edges;
+    }
+
+    edges.reserve(edgeCount);
+
+    while (edges.size() < edgeCount)
+    {
+        int from = rankDist(rng);
+
+        // 범위를 넘어간 값을 마지막 정점으로 자르면 그 정점에 간선이 몰리기 때문에 갈 수 있는 범위 안에서 고른다.
+        int last = (int)std::min<int64_t>((int64_t)from + span, vertexCount - 1);
+        int to   = std::uniform_int_distribution<int>{ from + 1, last }(rng);
+
+        edges.push_back({ vertexAt[from], vertexAt[to], 1 });
+    }
+
+    return edges;
+}
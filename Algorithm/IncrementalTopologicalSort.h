@@ -0,0 +1,237 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+// 점진적 위상 정렬(Pearce-Kelly 알고리즘)
+// : 간선이 하나씩 추가되는 그래프에서 위상 정렬 순서를 유지한다.
+//
+// 간선이 추가될 때마다 TopologicalSort.h(칸 알고리즘)로 다시 정렬하면 매번 O(V + E)가 든다.
+// 그런데 간선 (from -> to)를 추가해도 순서가 깨지는 범위는 정해져 있다.
+//
+// - ord[from] < ord[to]라면 이미 올바른 순서이므로 아무것도 하지 않는다.
+// - ord[from] > ord[to]라면 영향을 받는 범위는 [ord[to], ord[from]] 구간뿐이다.
+//   1. to에서 정방향으로 DFS하면서 순서가 ord[from]보다 앞에 있는 정점을 모은다(F).
+//      이때 from에 도달한다면 사이클이 생기는 간선이므로 추가하지 않는다.
+//   2. from에서 역방향으로 DFS하면서 순서가 ord[to]보다 뒤에 있는 정점을 모은다(B).
+//   3. F와 B가 원래 차지하고 있던 순서 값들을 모아서 정렬한 다음
+//      B의 정점들(기존 순서 유지)을 앞쪽에, F의 정점들(기존 순서 유지)을 뒤쪽에 배치한다.
+//      구간 안에서도 F와 B에 속하지 않는 정점은 움직이지 않는다.
+//
+// 비용은 영향을 받는 구간 안에서 실제로 방문한 정점과 간선의 수에 비례한다.
+// 대부분의 간선이 이미 순서에 맞게 들어오는 그래프(빌드 의존성처럼)라면 간선 추가가 거의 O(1)이다.
+//
+// 간선을 계속 추가하는 구조라서 인접 정보는 CSRGraph가 아니라 정점별 vector로 관리한다.
+// DFS는 재귀 대신 스택 배열을 사용하고 탐색에 쓰는 임시 배열은 멤버로 두고 재사용한다.
+
+class IncrementalTopologicalOrder
+{
+public:
+    explicit IncrementalTopologicalOrder(int vertexCount)
+        : _out(vertexCount), _in(vertexCount), _ord(vertexCount), _vertexAt(vertexCount), _visited(vertexCount, 0)
+    {
+        // 간선이 없다면 어떤 순서든 올바르다.
+        for (int v = 0; v < vertexCount; v++)
+        {
+            _ord[v]      = v;
+            _vertexAt[v] = v;
+        }
+    }
+
+public:
+    // 사이클이 생기는 간선이라면 추가하지 않고 false를 반환한다.
+    bool AddEdge(int from, int to)
+    {
+        if (from == to)
+            return false;
+
+        int lower = _ord[to];
+        int upper = _ord[from];
+
+        if (upper > lower)
+        {
+            // 1. 정방향 탐색(from에 도달하면 사이클)
+            if (false == this->searchForward(to, upper))
+            {
+                this->clearVisited(_forward);
+
+                return false;
+            }
+
+            // 2. 역방향 탐색
+            this->searchBackward(from, lower);
+
+            // 3. 재배치
+            this->reorder();
+        }
+
+        _out[from].push_back(to);
+        _in[to].push_back(from);
+
+        _edgeCount++;
+
+        return true;
+    }
+
+    // 정점 v의 순서(0부터 시작)
+    int Position(int v) const { return _ord[v]; }
+
+    // 위상 정렬 순서대로 나열한 정점
+    const std::vector<int>& Order() const { return _vertexAt; }
+
+    int    VertexCount() const { return (int)_ord.size(); }
+    size_t EdgeCount() const   { return _edgeCount; }
+
+    // 지금까지 재배치된 정점의 누적 개수
+    size_t ReorderedCount() const { return _reorderedCount; }
+
+private:
+    // 순서가 upper보다 앞에 있는 정점만 방문한다(upper에 있는 정점은 from).
+    bool searchForward(int start, int upper)
+    {
+        _forward.clear();
+        _stack.clear();
+
+        _visited[start] = 1;
+        _forward.push_back(start);
+        _stack.push_back(start);
+
+        while (false == _stack.empty())
+        {
+            int here = _stack.back();
+            _stack.pop_back();
+
+            for (int next : _out[here])
+            {
+                if (_ord[next] == upper)
+                    return false;
+
+                if (1 == _visited[next] || _ord[next] > upper)
+                    continue;
+
+                _visited[next] = 1;
+                _forward.push_back(next);
+                _stack.push_back(next);
+            }
+        }
+
+        return true;
+    }
+
+    // 순서가 lower보다 뒤에 있는 정점만 방문한다.
+    // (F와 B가 겹친다면 사이클이 있다는 뜻이므로 _visited를 같이 써도 된다.)
+    void searchBackward(int start, int lower)
+    {
+        _backward.clear();
+        _stack.clear();
+
+        _visited[start] = 1;
+        _backward.push_back(start);
+        _stack.push_back(start);
+
+        while (false == _stack.empty())
+        {
+            int here = _stack.back();
+            _stack.pop_back();
+
+            for (int prev : _in[here])
+            {
+                if (1 == _visited[prev] || _ord[prev] < lower)
+                    continue;
+
+                _visited[prev] = 1;
+                _backward.push_back(prev);
+                _stack.push_back(prev);
+            }
+        }
+    }
+
+    void reorder()
+    {
+        this->sortByOrd(_forward);
+        this->sortByOrd(_backward);
+
+        // B와 F가 차지하고 있던 순서 값(각각 정렬되어 있으니 병합만 하면 됨)
+        _slots.clear();
+
+        for (int v : _backward)
+        {
+            _slots.push_back(_ord[v]);
+        }
+
+        size_t middle = _slots.size();
+
+        for (int v : _forward)
+        {
+            _slots.push_back(_ord[v]);
+        }
+
+        std::inplace_merge(_slots.begin(), _slots.begin() + middle, _slots.end());
+
+        // B를 앞에, F를 뒤에 배치
+        size_t slot = 0;
+
+        for (int v : _backward)
+        {
+            _ord[v] = _slots[slot++];
+            _vertexAt[_ord[v]] = v;
+        }
+
+        for (int v : _forward)
+        {
+            _ord[v] = _slots[slot++];
+            _vertexAt[_ord[v]] = v;
+        }
+
+        this->clearVisited(_forward);
+        this->clearVisited(_backward);
+
+        _reorderedCount += _slots.size();
+    }
+
+    // (순서, 정점)을 64비트 값 하나로 묶어서 정렬한다(비교할 때마다 _ord를 읽지 않아도 됨).
+    void sortByOrd(std::vector<int>& vertices)
+    {
+        _keys.clear();
+
+        for (int v : vertices)
+        {
+            _keys.push_back(((uint64_t)_ord[v] << 32) | (uint32_t)v);
+        }
+
+        std::sort(_keys.begin(), _keys.end());
+
+        for (size_t idx = 0; idx < _keys.size(); idx++)
+        {
+            vertices[idx] = (int)(uint32_t)_keys[idx];
+        }
+    }
+
+    void clearVisited(const std::vector<int>& vertices)
+    {
+        for (int v : vertices)
+        {
+            _visited[v] = 0;
+        }
+    }
+
+private:
+    std::vector<std::vector<int>> _out;
+    std::vector<std::vector<int>> _in;
+
+    std::vector<int>     _ord;      // 정점 -> 순서
+    std::vector<int>     _vertexAt; // 순서 -> 정점
+    std::vector<uint8_t> _visited;
+
+    // 탐색용 임시 배열(재사용)
+    std::vector<int> _forward;
+    std::vector<int> _backward;
+    std::vector<int> _stack;
+    std::vector<int> _slots;
+
+    std::vector<uint64_t> _keys;
+
+    size_t _edgeCount      = 0;
+    size_t _reorderedCount = 0;
+};
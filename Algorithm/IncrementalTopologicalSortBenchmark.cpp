@@ -0,0 +1,137 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "GraphGenerator.h"
+#include "TopologicalSort.h"
+#include "IncrementalTopologicalSort.h"
+
+// IncrementalTopologicalSort.h 측정
+//
+// 정점 10만 개의 그래프에 간선을 하나씩 추가하면서 간선 추가 처리량(초당 추가 횟수)을 측정한다.
+// - Incremental : IncrementalTopologicalOrder::AddEdge()
+// - Recompute   : 간선을 추가할 때마다 CSR을 만들고 KahnTopologicalSort()로 다시 정렬(사이클이면 간선을 되돌림)
+//                 너무 느리기 때문에 마지막 kRecomputeInserts개의 간선만 처리한다(앞의 간선은 미리 넣어 둠).
+//
+// 1. DAG    : 숨겨진 순서를 따르는 간선 15만 개를 무작위 순서로 추가(모두 추가되어야 함)
+//             처음 순서(정점 번호 순)와 숨겨진 순서가 전혀 관계가 없어서 재배치가 많이 일어나는 나쁜 경우이다.
+// 2. Random : 아무 정점 쌍으로 만든 간선 15만 개를 추가(사이클이 생기는 간선은 거부됨)
+//
+// 두 방식이 마지막 kRecomputeInserts개의 간선을 똑같이 받아들이거나 거부하는지 확인하고
+// 최종 순서에서 추가된 모든 간선이 앞 -> 뒤를 향하는지 확인한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int    kVertexCount      = 100'000;
+constexpr size_t kRecomputeInserts = 200;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+vector<GraphEdge> MakeRandomPairs(int vertexCount, size_t edgeCount, uint32_t seed = 1)
+{
+    mt19937 rng{ seed };
+    uniform_int_distribution<int> vertexDist{ 0, vertexCount - 1 };
+
+    vector<GraphEdge> edges(edgeCount);
+
+    for (GraphEdge& edge : edges)
+    {
+        edge = { vertexDist(rng), vertexDist(rng), 1 };
+    }
+
+    return edges;
+}
+
+void Run(const char* name, const vector<GraphEdge>& edges)
+{
+    cout << name << " (V : " << kVertexCount << ", Inserts : " << edges.size() << ")\n";
+
+    IncrementalTopologicalOrder order{ kVertexCount };
+
+    vector<bool> accepted(edges.size());
+
+    double elapsed = Measure([&] {
+        for (size_t idx = 0; idx < edges.size(); idx++)
+        {
+            accepted[idx] = order.AddEdge(edges[idx].from, edges[idx].to);
+        }
+    });
+
+    // 최종 순서 확인
+    bool isValid = true;
+
+    for (size_t idx = 0; idx < edges.size(); idx++)
+    {
+        if (true == accepted[idx] && order.Position(edges[idx].from) >= order.Position(edges[idx].to))
+        {
+            isValid = false;
+        }
+    }
+
+    cout << "Incremental : " << elapsed << "s, " << edges.size() / elapsed << " inserts/s"
+         << ", Accepted : " << order.EdgeCount() << ", Rejected : " << edges.size() - order.EdgeCount()
+         << ", Reordered/insert : " << (double)order.ReorderedCount() / edges.size() << (isValid ? "" : " (Mismatch!)") << '\n';
+
+    // 마지막 kRecomputeInserts개의 간선을 다시 정렬하는 방식으로 처리
+    size_t first = edges.size() - min(kRecomputeInserts, edges.size());
+
+    vector<GraphEdge> current;
+
+    for (size_t idx = 0; idx < first; idx++)
+    {
+        if (true == accepted[idx])
+        {
+            current.push_back(edges[idx]);
+        }
+    }
+
+    vector<int> sorted;
+    bool        isSame = true;
+
+    double recomputeTime = Measure([&] {
+        for (size_t idx = first; idx < edges.size(); idx++)
+        {
+            current.push_back(edges[idx]);
+
+            bool isDag = KahnTopologicalSort(CSRGraph<int>{ kVertexCount, current }, sorted);
+
+            if (false == isDag)
+            {
+                current.pop_back();
+            }
+
+            if (isDag != accepted[idx])
+            {
+                isSame = false;
+            }
+        }
+    });
+
+    cout << "Recompute   : " << recomputeTime << "s, " << (edges.size() - first) / recomputeTime << " inserts/s"
+         << (isSame ? "" : " (Mismatch!)") << "\n\n";
+}
+
+int main()
+{
+    Run("DAG   ", MakeRandomDag(kVertexCount, 150'000, 1'000));
+    Run("Random", MakeRandomPairs(kVertexCount, 150'000));
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+// 인덱스 기반 최소 힙(Indexed Heap)
+// : 예전 PriorityQueue.cpp에 있던 UpdateValueAtIndex()를 확장한 형태
+//
+// 예전 UpdateValueAtIndex()는 힙 배열의 인덱스를 받는데
+// 원소는 bubbleUp()과 sinkDown()을 거치면서 계속 위치가 바뀌기 때문에 호출하는 쪽에서는 이 인덱스를 알 수가 없다.
+//
+// 그래서 원소마다 고정된 ID(다익스트라라면 정점 번호)를 부여하고
+// ID -> 힙 슬롯을 가리키는 위치 테이블(_pos)을 두어서 원소가 이동할 때마다 함께 갱신한다.
+// 이러면 DecreaseKey(id, key)로 특정 원소의 우선순위를 직접 낮출 수 있다.
+//
+// 다익스트라에 적용하면?
+// - 기존 방식 : 갱신할 때마다 새로 push하고 꺼낼 때 visited로 걸러냄(힙의 크기가 최대 E)
+// - 인덱스 힙 : 이미 들어 있는 정점이면 DecreaseKey()로 위치만 조정함(힙의 크기가 최대 V)
+//
+// Arity는 자식 노드의 개수이다.
+// 4-ary 힙은 트리의 높이가 낮아서 DecreaseKey()(bubbleUp)가 빠르고
+// 자식 4개가 한 캐시 라인에 모여 있어서 sinkDown()의 비교 비용도 크게 늘지 않는다.
+
+template <typename Key, int Arity = 4>
+class IndexedHeap
+{
+    static_assert(Arity >= 2, "Arity must be at least 2.");
+
+public:
+    static constexpr int kNotInHeap = -1;
+
+public:
+    // ID는 [0, capacity) 범위를 사용한다.
+    explicit IndexedHeap(int capacity)
+        : _pos(capacity, kNotInHeap)
+    {
+        _heap.reserve(capacity);
+    }
+
+public:
+    void Push(int id, Key key)
+    {
+        _heap.push_back({ key, id });
+        _pos[id] = (int)_heap.size() - 1;
+
+        this->bubbleUp((int)_heap.size() - 1);
+    }
+
+    // 키가 작아진 경우에만 사용(위로만 이동)
+    void DecreaseKey(int id, Key key)
+    {
+        int slot = _pos[id];
+
+        _heap[slot].first = key;
+
+        this->bubbleUp(slot);
+    }
+
+    // 힙에 없으면 넣고 있으면 키를 낮춘다.
+    // 키가 작아지지 않았으면 아무것도 하지 않고 false를 반환한다.
+    bool PushOrDecrease(int id, Key key)
+    {
+        int slot = _pos[id];
+
+        if (kNotInHeap == slot)
+        {
+            this->Push(id, key);
+
+            return true;
+        }
+
+        if (false == (key < _heap[slot].first))
+            return false;
+
+        this->DecreaseKey(id, key);
+
+        return true;
+    }
+
+    // 키, ID
+    std::pair<Key, int> Pop()
+    {
+        std::pair<Key, int> top = _heap[0];
+
+        _pos[top.second] = kNotInHeap;
+
+        if (_heap.size() > 1)
+        {
+            _heap[0] = _heap.back();
+            _pos[_heap[0].second] = 0;
+        }
+
+        _heap.pop_back();
+
+        if (false == _heap.empty())
+        {
+            this->sinkDown(0);
+        }
+
+        return top;
+    }
+
+    const std::pair<Key, int>& Top() const { return _heap[0]; }
+
+    void Clear()
+    {
+        for (const auto& [key, id] : _heap)
+        {
+            _pos[id] = kNotInHeap;
+        }
+
+        _heap.clear();
+    }
+
+public:
+    bool Contains(int id) const { return kNotInHeap != _pos[id]; }
+    Key  KeyOf(int id) const    { return _heap[_pos[id]].first; }
+
+    bool Empty() const { return _heap.empty(); }
+    int  Count() const { return (int)_heap.size(); }
+
+private:
+    // 힙 관련 함수
+    // 원소를 옮길 때마다 _pos도 같이 갱신해야 한다(swap 대신 빈 자리를 옮기는 방식 사용).
+    void bubbleUp(int idx)
+    {
+        std::pair<Key, int> item = _heap[idx];
+
+        while (idx > 0)
+        {
+            int parent = (idx - 1) / Arity;
+
+            // 부모의 값이 작거나 같으면 종료
+            if (false == (item.first < _heap[parent].first))
+                break;
+
+            _heap[idx] = _heap[parent];
+            _pos[_heap[idx].second] = idx;
+
+            idx = parent;
+        }
+
+        _heap[idx] = item;
+        _pos[item.second] = idx;
+    }
+
+    void sinkDown(int idx)
+    {
+        std::pair<Key, int> item = _heap[idx];
+
+        int count = (int)_heap.size();
+
+        while (true)
+        {
+            int firstChild = idx * Arity + 1;
+
+            if (firstChild >= count)
+                break;
+
+            int lastChild = firstChild + Arity < count ? firstChild + Arity : count;
+            int nextChild = firstChild;
+
+            for (int child = firstChild + 1; child < lastChild; child++)
+            {
+                if (_heap[child].first < _heap[nextChild].first)
+                {
+                    nextChild = child;
+                }
+            }
+
+            // 자식 노드의 값이 더 크거나 같으면 종료
+            if (false == (_heap[nextChild].first < item.first))
+                break;
+
+            _heap[idx] = _heap[nextChild];
+            _pos[_heap[idx].second] = idx;
+
+            idx = nextChild;
+        }
+
+        _heap[idx] = item;
+        _pos[item.second] = idx;
+    }
+
+private:
+    std::vector<std::pair<Key, int>> _heap; // 키, ID
+    std::vector<int> _pos; // ID -> 힙 슬롯
+};
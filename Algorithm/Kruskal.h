@@ -0,0 +1,245 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <array>
+#include <span>
+#include <bit>
+#include <utility>
+#include <algorithm>
+
+#include "CSRGraph.h"
+#include "DisjointSet.h"
+
+// 크루스칼 알고리즘(MinimumSpanningTree.cpp 참고)의 개선 버전
+//
+// MinimumSpanningTree.cpp는 모든 간선을 priority_queue에 넣고 하나씩 꺼낸다.
+// - 간선마다 O(log E)의 push, pop 비용이 든다.
+// - 신장 트리가 완성되어도(간선 V - 1개) 힙이 빌 때까지 계속 꺼낸다.
+//
+// 1. KruskalRadix
+//    : 간선 배열 하나를 가중치 기준으로 LSD 기수 정렬(Radix sort)한 다음 앞에서부터 확인한다.
+//      가중치를 8비트씩 4자리로 보고 낮은 자리부터 안정 정렬(계수 정렬)을 반복한다.
+//      모든 자리의 개수를 한 번의 순회로 세어 두고 모든 간선의 값이 같은 자리는 건너뛴다.
+//      (가중치가 65535 이하라면 2번의 이동만으로 정렬이 끝난다.)
+//      간선을 V - 1개 채우면 나머지 간선은 확인하지 않는다.
+//
+// 2. FilterKruskal
+//    : 퀵 정렬처럼 기준 가중치로 간선을 가벼운 쪽과 무거운 쪽으로 나눈다.
+//      가벼운 쪽을 먼저 처리하고 나면 무거운 쪽 간선 중 이미 같은 집합에 속한 간선은 절대 선택되지 않으므로
+//      정렬하기 전에 걸러낸다(filter). 간선이 정점보다 훨씬 많은 그래프에서는 대부분의 간선이 정렬되지 않고 버려진다.
+//      구간이 충분히 작아지면 정렬한 다음 일반 크루스칼로 처리한다.
+//      기준값이 계속 한쪽으로 치우치면 재귀가 깊어지기 때문에 인트로 정렬(introsort)처럼 깊이를 2 * log2(E)로 제한하고
+//      제한을 넘으면 남은 구간을 기수 정렬해서 처리한다.
+//
+// 음의 가중치도 처리할 수 있도록 기수 정렬은 부호 비트를 뒤집은 값을 키로 사용한다.
+// 그래프가 연결되어 있지 않다면 최소 신장 포레스트(Minimum spanning forest)를 구한다.
+
+using GraphEdge = CSRGraph<int>::Edge;
+
+struct SpanningTree
+{
+    int64_t weight = 0;
+
+    std::vector<GraphEdge> edges;
+};
+
+// 가중치 기준 LSD 기수 정렬(안정 정렬), buffer는 임시 공간으로 사용한다.
+inline void RadixSortEdges(std::vector<GraphEdge>& edges, std::vector<GraphEdge>& buffer)
+{
+    constexpr int kDigitBits  = 8;
+    constexpr int kDigitCount = 4;
+    constexpr int kRadix      = 1 << kDigitBits;
+
+    auto keyOf = [](const GraphEdge& edge) {
+        return (uint32_t)edge.weight ^ 0x8000'0000u;
+    };
+
+    std::array<std::array<size_t, kRadix>, kDigitCount> counts{};
+
+    for (const GraphEdge& edge : edges)
+    {
+        uint32_t key = keyOf(edge);
+
+        for (int digit = 0; digit < kDigitCount; digit++)
+        {
+            counts[digit][(key >> (digit * kDigitBits)) & (kRadix - 1)]++;
+        }
+    }
+
+    buffer.resize(edges.size());
+
+    for (int digit = 0; digit < kDigitCount; digit++)
+    {
+        std::array<size_t, kRadix>& count = counts[digit];
+
+        // 모든 간선이 같은 값이라면 이 자리는 정렬할 필요가 없다.
+        if (edges.empty() || edges.size() == count[(keyOf(edges[0]) >> (digit * kDigitBits)) & (kRadix - 1)])
+            continue;
+
+        size_t offset = 0;
+
+        for (size_t& bucket : count)
+        {
+            size_t bucketSize = bucket;
+
+            bucket  = offset;
+            offset += bucketSize;
+        }
+
+        for (const GraphEdge& edge : edges)
+        {
+            buffer[count[(keyOf(edge) >> (digit * kDigitBits)) & (kRadix - 1)]++] = edge;
+        }
+
+        edges.swap(buffer);
+    }
+}
+
+// edges는 정렬하면서 순서가 바뀐다.
+inline SpanningTree KruskalRadix(int vertexCount, std::vector<GraphEdge>& edges)
+{
+    std::vector<GraphEdge> buffer;
+
+    RadixSortEdges(edges, buffer);
+
+    SpanningTree tree;
+
+    tree.edges.reserve(std::max(0, vertexCount - 1));
+
+    DisjointSet set{ vertexCount };
+
+    for (const GraphEdge& edge : edges)
+    {
+        if (false == set.Union(edge.from, edge.to))
+            continue;
+
+        tree.weight += edge.weight;
+        tree.edges.push_back(edge);
+
+        // 신장 트리 완성
+        if ((int)tree.edges.size() == vertexCount - 1)
+            break;
+    }
+
+    return tree;
+}
+
+namespace FilterKruskalDetail
+{
+    // 이 크기 이하라면 바로 정렬해서 처리한다.
+    constexpr size_t kBaseCaseSize = 1 << 12;
+
+    struct Context
+    {
+        int          vertexCount;
+        DisjointSet  set;
+        SpanningTree tree;
+
+        std::vector<GraphEdge> sorted; // 기수 정렬용
+        std::vector<GraphEdge> buffer;
+
+        bool IsComplete() const { return (int)tree.edges.size() >= vertexCount - 1; }
+    };
+
+    // 정렬된 간선을 앞에서부터 확인한다.
+    inline void UnionSorted(Context& ctx, std::span<const GraphEdge> edges)
+    {
+        for (const GraphEdge& edge : edges)
+        {
+            if (true == ctx.IsComplete())
+                return;
+
+            if (false == ctx.set.Union(edge.from, edge.to))
+                continue;
+
+            ctx.tree.weight += edge.weight;
+            ctx.tree.edges.push_back(edge);
+        }
+    }
+
+    inline void BaseCase(Context& ctx, std::span<GraphEdge> edges)
+    {
+        std::sort(edges.begin(), edges.end(), [](const GraphEdge& lhs, const GraphEdge& rhs) {
+            return lhs.weight < rhs.weight;
+        });
+
+        UnionSorted(ctx, edges);
+    }
+
+    // 재귀 깊이 제한을 넘었을 때 사용한다(구간의 크기와 상관없이 O(n)).
+    inline void RadixCase(Context& ctx, std::span<const GraphEdge> edges)
+    {
+        ctx.sorted.assign(edges.begin(), edges.end());
+
+        RadixSortEdges(ctx.sorted, ctx.buffer);
+
+        UnionSorted(ctx, ctx.sorted);
+    }
+
+    inline void Run(Context& ctx, std::span<GraphEdge> edges, int depthLimit)
+    {
+        if (true == ctx.IsComplete() || edges.empty())
+            return;
+
+        if (edges.size() <= kBaseCaseSize)
+        {
+            BaseCase(ctx, edges);
+
+            return;
+        }
+
+        if (0 == depthLimit)
+        {
+            RadixCase(ctx, edges);
+
+            return;
+        }
+
+        // 세 개의 가중치 중 중간값을 기준으로 사용한다.
+        int a = edges.front().weight;
+        int b = edges[edges.size() / 2].weight;
+        int c = edges.back().weight;
+
+        int pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+
+        auto middle = std::partition(edges.begin(), edges.end(), [pivot](const GraphEdge& edge) {
+            return edge.weight <= pivot;
+        });
+
+        std::span<GraphEdge> light{ edges.begin(), middle };
+        std::span<GraphEdge> heavy{ middle, edges.end() };
+
+        // 모든 간선이 기준값 이하라면(같은 가중치가 많음) 더 나눌 수 없으니 정렬해서 처리한다.
+        if (true == heavy.empty())
+        {
+            BaseCase(ctx, edges);
+
+            return;
+        }
+
+        Run(ctx, light, depthLimit - 1);
+
+        if (true == ctx.IsComplete())
+            return;
+
+        // 이미 같은 집합에 속한 간선을 걸러낸다.
+        auto kept = std::remove_if(heavy.begin(), heavy.end(), [&ctx](const GraphEdge& edge) {
+            return ctx.set.Find(edge.from) == ctx.set.Find(edge.to);
+        });
+
+        Run(ctx, std::span<GraphEdge>{ heavy.begin(), kept }, depthLimit - 1);
+    }
+}
+
+// edges는 처리하면서 순서가 바뀐다.
+inline SpanningTree FilterKruskal(int vertexCount, std::vector<GraphEdge>& edges)
+{
+    FilterKruskalDetail::Context ctx{ vertexCount, DisjointSet{ vertexCount }, {}, {}, {} };
+
+    ctx.tree.edges.reserve(std::max(0, vertexCount - 1));
+
+    FilterKruskalDetail::Run(ctx, edges, 2 * (int)std::bit_width(edges.size()));
+
+    return std::move(ctx.tree);
+}
@@ -0,0 +1,139 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <queue>
+#include <algorithm>
+
+#include "GraphGenerator.h"
+#include "DisjointSet.h"
+#include "Kruskal.h"
+
+// Kruskal.h 측정
+//
+// 무방향 랜덤 그래프에서 최소 신장 트리를 구하는 시간을 비교한다.
+// - PriorityQueue : MinimumSpanningTree.cpp의 방식(모든 간선을 힙에 넣고 빌 때까지 꺼냄)
+// - std::sort     : 간선 배열을 std::sort로 정렬한 다음 크루스칼
+// - Radix         : KruskalRadix()
+// - Filter        : FilterKruskal()
+//
+// 평균 차수를 늘려가면서 측정하면 간선이 많을수록 FilterKruskal()이 유리해지는 것을 볼 수 있다.
+// 모든 방식의 가중치 합이 같은지 확인한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+int64_t KruskalPriorityQueue(int vertexCount, const vector<GraphEdge>& edges)
+{
+    auto comp = [](const GraphEdge& lhs, const GraphEdge& rhs) { return lhs.weight > rhs.weight; };
+
+    priority_queue<GraphEdge, vector<GraphEdge>, decltype(comp)> pq{ comp };
+
+    for (const GraphEdge& edge : edges)
+    {
+        pq.push(edge);
+    }
+
+    DisjointSet set{ vertexCount };
+
+    int64_t weight = 0;
+
+    while (false == pq.empty())
+    {
+        GraphEdge edge = pq.top();
+        pq.pop();
+
+        if (true == set.Union(edge.from, edge.to))
+        {
+            weight += edge.weight;
+        }
+    }
+
+    return weight;
+}
+
+int64_t KruskalStdSort(int vertexCount, vector<GraphEdge>& edges)
+{
+    sort(edges.begin(), edges.end(), [](const GraphEdge& lhs, const GraphEdge& rhs) {
+        return lhs.weight < rhs.weight;
+    });
+
+    DisjointSet set{ vertexCount };
+
+    int64_t weight = 0;
+    int     picked = 0;
+
+    for (const GraphEdge& edge : edges)
+    {
+        if (false == set.Union(edge.from, edge.to))
+            continue;
+
+        weight += edge.weight;
+
+        if (++picked == vertexCount - 1)
+            break;
+    }
+
+    return weight;
+}
+
+int main()
+{
+    constexpr int kVertexCount = 1'000'000;
+
+    for (size_t degree : { 4, 16, 32 })
+    {
+        const vector<GraphEdge> edges = MakeRandomGraph(kVertexCount, kVertexCount * degree, 1'000'000);
+
+        cout << "V : " << kVertexCount << ", E : " << edges.size() << '\n';
+
+        int64_t pqWeight = 0;
+
+        double pqTime = Measure([&] { pqWeight = KruskalPriorityQueue(kVertexCount, edges); });
+
+        vector<GraphEdge> work = edges;
+
+        int64_t sortWeight = 0;
+
+        double sortTime = Measure([&] { sortWeight = KruskalStdSort(kVertexCount, work); });
+
+        work = edges;
+
+        SpanningTree radix;
+
+        double radixTime = Measure([&] { radix = KruskalRadix(kVertexCount, work); });
+
+        work = edges;
+
+        SpanningTree filter;
+
+        double filterTime = Measure([&] { filter = FilterKruskal(kVertexCount, work); });
+
+        bool isValid = (pqWeight == sortWeight) && (sortWeight == radix.weight) && (radix.weight == filter.weight)
+                    && (radix.edges.size() == filter.edges.size());
+
+        cout << "PriorityQueue : " << pqTime << "s"
+             << ", std::sort : " << sortTime << "s"
+             << ", Radix : " << radixTime << "s"
+             << ", Filter : " << filterTime << "s"
+             << ", weight : " << radix.weight << (isValid ? "" : " (Mismatch!)") << "\n\n";
+    }
+
+    return 0;
+}
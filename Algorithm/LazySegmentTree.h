@@ -0,0 +1,307 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <span>
+#include <bit>
+#include <limits>
+#include <optional>
+#include <algorithm>
+
+// 느리게 갱신되는 세그먼트 트리(Lazy Propagation Segment Tree)
+//
+// 펜윅 트리는 역연산이 있는 연산(합)에 특화되어 있어서 구간 최솟값이나 구간 대입 같은 작업은 처리할 수 없다.
+// 세그먼트 트리는 모든 구간 노드를 만들어 두기 때문에 결합 법칙만 만족하면 어떤 연산이든 사용할 수 있다.
+//
+// 구조
+// - 크기를 2의 거듭제곱(size)으로 맞추고 배열 하나에 트리를 저장한다(재귀 없이 반복문으로 처리).
+//   노드 1이 루트이고 노드 k의 자식은 2k, 2k + 1이며 리프는 [size, 2 * size)에 있다.
+// - 구간 갱신은 해당 구간을 완전히 덮는 노드에만 적용하고 자식에게 전달할 갱신은 _lazy에 미뤄둔다.
+//   나중에 그 노드의 아래쪽을 방문해야 할 때 push()로 자식에게 내려준다.
+// - 반복문 방식은 구간의 양 끝에서 루트까지의 경로만 push하면 되므로
+//   먼저 위에서 아래로 밀어내리고 구간을 처리한 다음 아래에서 위로 값을 다시 계산한다.
+//
+// Policy는 다음을 제공해야 한다(모노이드와 갱신을 정의).
+// - Value, Lazy                     : 노드에 저장할 값, 미뤄둘 갱신
+// - Value Identity()                : Combine()의 항등원
+// - Value Combine(Value, Value)     : 결합 법칙을 만족하는 연산(교환 법칙은 필요 없음)
+// - Lazy  NoUpdate()                : 아무것도 하지 않는 갱신
+// - Value Apply(Lazy, Value, len)   : 길이가 len인 구간의 값에 갱신을 적용
+// - Lazy  Compose(Lazy newer, Lazy older) : 이미 미뤄둔 갱신(older) 다음에 newer를 적용하는 갱신
+//
+// 인덱스는 [0, n)이며 구간은 [left, right)로 지정한다.
+
+template <typename Policy>
+class LazySegmentTree
+{
+public:
+    using Value = typename Policy::Value;
+    using Lazy  = typename Policy::Lazy;
+
+public:
+    explicit LazySegmentTree(size_t count = 0)
+    {
+        this->Reset(count);
+    }
+
+    explicit LazySegmentTree(std::span<const Value> values)
+    {
+        this->Build(values);
+    }
+
+public:
+    // 모든 값을 항등원으로 초기화한다.
+    void Reset(size_t count)
+    {
+        _count = count;
+        _size  = std::bit_ceil(std::max<size_t>(1, count));
+        _log   = std::countr_zero(_size);
+
+        _data.assign(2 * _size, Policy::Identity());
+        _lazy.assign(_size, Policy::NoUpdate());
+    }
+
+    // O(n)
+    void Build(std::span<const Value> values)
+    {
+        this->Reset(values.size());
+
+        std::copy(values.begin(), values.end(), _data.begin() + _size);
+
+        for (size_t node = _size - 1; node >= 1; node--)
+        {
+            this->pull(node);
+        }
+    }
+
+    void Set(size_t idx, Value value)
+    {
+        idx += _size;
+
+        this->pushPath(idx);
+
+        _data[idx] = value;
+
+        this->pullPath(idx);
+    }
+
+    Value Get(size_t idx)
+    {
+        idx += _size;
+
+        this->pushPath(idx);
+
+        return _data[idx];
+    }
+
+    // [left, right)
+    Value Query(size_t left, size_t right)
+    {
+        if (left >= right)
+            return Policy::Identity();
+
+        left  += _size;
+        right += _size;
+
+        this->pushBoundary(left, right);
+
+        Value leftSum  = Policy::Identity();
+        Value rightSum = Policy::Identity();
+
+        for (; left < right; left >>= 1, right >>= 1)
+        {
+            if (left & 1)
+            {
+                leftSum = Policy::Combine(leftSum, _data[left++]);
+            }
+
+            if (right & 1)
+            {
+                rightSum = Policy::Combine(_data[--right], rightSum);
+            }
+        }
+
+        return Policy::Combine(leftSum, rightSum);
+    }
+
+    Value QueryAll() const { return _data[1]; }
+
+    // [left, right)에 update를 적용한다.
+    void Apply(size_t left, size_t right, Lazy update)
+    {
+        if (left >= right)
+            return;
+
+        left  += _size;
+        right += _size;
+
+        this->pushBoundary(left, right);
+
+        for (size_t l = left, r = right; l < r; l >>= 1, r >>= 1)
+        {
+            if (l & 1)
+            {
+                this->applyNode(l++, update);
+            }
+
+            if (r & 1)
+            {
+                this->applyNode(--r, update);
+            }
+        }
+
+        // 양 끝에서 루트까지 값을 다시 계산한다(구간 안에 완전히 포함된 노드는 제외).
+        for (int level = 1; level <= _log; level++)
+        {
+            if (((left >> level) << level) != left)
+            {
+                this->pull(left >> level);
+            }
+
+            if (((right >> level) << level) != right)
+            {
+                this->pull((right - 1) >> level);
+            }
+        }
+    }
+
+    size_t Size() const { return _count; }
+
+private:
+    // 노드가 담당하는 구간의 길이
+    size_t lengthOf(size_t node) const
+    {
+        return _size >> (std::bit_width(node) - 1);
+    }
+
+    void pull(size_t node)
+    {
+        _data[node] = Policy::Combine(_data[2 * node], _data[2 * node + 1]);
+    }
+
+    void applyNode(size_t node, const Lazy& update)
+    {
+        _data[node] = Policy::Apply(update, _data[node], this->lengthOf(node));
+
+        if (node < _size)
+        {
+            _lazy[node] = Policy::Compose(update, _lazy[node]);
+        }
+    }
+
+    void push(size_t node)
+    {
+        this->applyNode(2 * node, _lazy[node]);
+        this->applyNode(2 * node + 1, _lazy[node]);
+
+        _lazy[node] = Policy::NoUpdate();
+    }
+
+    // 리프에서 루트까지의 경로(루트부터)
+    void pushPath(size_t leaf)
+    {
+        for (int level = _log; level >= 1; level--)
+        {
+            this->push(leaf >> level);
+        }
+    }
+
+    void pullPath(size_t leaf)
+    {
+        for (int level = 1; level <= _log; level++)
+        {
+            this->pull(leaf >> level);
+        }
+    }
+
+    // 구간의 경계에 걸친 노드만 push한다.
+    void pushBoundary(size_t left, size_t right)
+    {
+        for (int level = _log; level >= 1; level--)
+        {
+            if (((left >> level) << level) != left)
+            {
+                this->push(left >> level);
+            }
+
+            if (((right >> level) << level) != right)
+            {
+                this->push((right - 1) >> level);
+            }
+        }
+    }
+
+private:
+    size_t _count = 0;
+    size_t _size  = 1;
+    int    _log   = 0;
+
+    std::vector<Value> _data;
+    std::vector<Lazy>  _lazy;
+};
+
+// 자주 사용하는 Policy
+
+// 구간 더하기 + 구간 합
+template <typename T>
+struct RangeAddSumPolicy
+{
+    using Value = T;
+    using Lazy  = T;
+
+    static Value Identity() { return T{}; }
+    static Value Combine(Value lhs, Value rhs) { return lhs + rhs; }
+
+    static Lazy  NoUpdate() { return T{}; }
+    static Value Apply(Lazy update, Value value, size_t length) { return value + update * (T)length; }
+    static Lazy  Compose(Lazy newer, Lazy older) { return newer + older; }
+};
+
+// 구간 대입 + 구간 합
+template <typename T>
+struct RangeAssignSumPolicy
+{
+    using Value = T;
+    using Lazy  = std::optional<T>;
+
+    static Value Identity() { return T{}; }
+    static Value Combine(Value lhs, Value rhs) { return lhs + rhs; }
+
+    static Lazy  NoUpdate() { return std::nullopt; }
+    static Value Apply(const Lazy& update, Value value, size_t length) { return update ? *update * (T)length : value; }
+    static Lazy  Compose(const Lazy& newer, const Lazy& older) { return newer ? newer : older; }
+};
+
+// 구간 더하기 + 구간 최솟값
+// : 항등원이 max()라서 Reset()만 한 트리(모든 값이 max())에 더하면 오버플로가 난다.
+//   반드시 Build()나 Set()으로 [0, n)의 값을 모두 채운 다음에 사용해야 한다.
+//   갱신은 [0, n) 안의 노드에만 적용되고 2의 거듭제곱으로 맞추면서 남은 리프(max())에는 NoUpdate()(0)만 내려가기 때문에
+//   항등원을 따로 검사하지 않고 그대로 더한다(값이 max()인 실제 원소도 다른 원소와 똑같이 갱신됨).
+template <typename T>
+struct RangeAddMinPolicy
+{
+    using Value = T;
+    using Lazy  = T;
+
+    static Value Identity() { return std::numeric_limits<T>::max(); }
+    static Value Combine(Value lhs, Value rhs) { return std::min(lhs, rhs); }
+
+    static Lazy  NoUpdate() { return T{}; }
+    static Value Apply(Lazy update, Value value, size_t) { return value + update; }
+    static Lazy  Compose(Lazy newer, Lazy older) { return newer + older; }
+};
+
+// 구간 대입 + 구간 최댓값
+template <typename T>
+struct RangeAssignMaxPolicy
+{
+    using Value = T;
+    using Lazy  = std::optional<T>;
+
+    static Value Identity() { return std::numeric_limits<T>::lowest(); }
+    static Value Combine(Value lhs, Value rhs) { return std::max(lhs, rhs); }
+
+    static Lazy  NoUpdate() { return std::nullopt; }
+    static Value Apply(const Lazy& update, Value value, size_t) { return update ? *update : value; }
+    static Lazy  Compose(const Lazy& newer, const Lazy& older) { return newer ? newer : older; }
+};
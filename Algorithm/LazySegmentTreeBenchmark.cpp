@@ -0,0 +1,290 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include "FenwickTree.h"
+#include "LazySegmentTree.h"
+
+// LazySegmentTree.h 측정
+//
+// 1. 작은 크기에서 단순 배열과 비교해서 각 Policy의 결과를 검증
+// 2. 펜윅 트리와 같은 작업(합)으로 처리량 비교
+//    - 점 갱신 + 구간 합   : FenwickTree       vs LazySegmentTree<RangeAddSumPolicy>
+//    - 구간 갱신 + 구간 합 : RangeFenwickTree  vs LazySegmentTree<RangeAddSumPolicy>
+//
+// 합처럼 펜윅 트리로 처리할 수 있는 작업이라면 펜윅 트리가 더 빠르고 메모리도 적게 쓴다.
+// 세그먼트 트리는 펜윅 트리로 표현할 수 없는 작업(구간 대입, 구간 최솟값/최댓값)에 사용하는 것이 좋다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr size_t kSize    = 1 << 20;
+constexpr size_t kOpCount = 2'000'000;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// 구간 갱신과 구간 조회를 번갈아 가면서 단순 배열과 비교한다.
+template <typename Policy, typename NaiveUpdate, typename NaiveQuery, typename MakeUpdate>
+bool Validate(mt19937& rng, NaiveUpdate&& naiveUpdate, NaiveQuery&& naiveQuery, MakeUpdate&& makeUpdate)
+{
+    constexpr size_t kTestSize = 1'000;
+
+    uniform_int_distribution<int64_t> valueDist{ -1'000, 1'000 };
+    uniform_int_distribution<size_t>  indexDist{ 0, kTestSize };
+
+    vector<int64_t> naive(kTestSize);
+
+    for (int64_t& value : naive)
+    {
+        value = valueDist(rng);
+    }
+
+    LazySegmentTree<Policy> tree{ span<const int64_t>{ naive } };
+
+    for (int op = 0; op < 20'000; op++)
+    {
+        size_t left  = indexDist(rng);
+        size_t right = indexDist(rng);
+
+        if (left > right)
+        {
+            swap(left, right);
+        }
+
+        switch (op % 3)
+        {
+            case 0:
+            {
+                int64_t value = valueDist(rng);
+
+                tree.Apply(left, right, makeUpdate(value));
+
+                for (size_t idx = left; idx < right; idx++)
+                {
+                    naive[idx] = naiveUpdate(naive[idx], value);
+                }
+
+                break;
+            }
+
+            case 1:
+            {
+                if (left < right && tree.Query(left, right) != naiveQuery(naive, left, right))
+                    return false;
+
+                break;
+            }
+
+            case 2:
+            {
+                if (left < kTestSize)
+                {
+                    int64_t value = valueDist(rng);
+
+                    tree.Set(left, value);
+                    naive[left] = value;
+
+                    if (tree.Get(left) != value)
+                        return false;
+                }
+
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+void RunValidation()
+{
+    mt19937 rng{ 1 };
+
+    auto sum = [](const vector<int64_t>& values, size_t left, size_t right) {
+        int64_t ret = 0;
+
+        for (size_t idx = left; idx < right; idx++)
+        {
+            ret += values[idx];
+        }
+
+        return ret;
+    };
+
+    auto minOf = [](const vector<int64_t>& values, size_t left, size_t right) {
+        return *min_element(values.begin() + left, values.begin() + right);
+    };
+
+    auto maxOf = [](const vector<int64_t>& values, size_t left, size_t right) {
+        return *max_element(values.begin() + left, values.begin() + right);
+    };
+
+    auto add    = [](int64_t value, int64_t update) { return value + update; };
+    auto assign = [](int64_t, int64_t update) { return update; };
+
+    auto plain    = [](int64_t value) { return value; };
+    auto optional = [](int64_t value) { return std::optional<int64_t>{ value }; };
+
+    cout << "Validation\n";
+    cout << "RangeAddSum    : " << (Validate<RangeAddSumPolicy<int64_t>>(rng, add, sum, plain) ? "OK" : "Mismatch!") << '\n';
+    cout << "RangeAssignSum : " << (Validate<RangeAssignSumPolicy<int64_t>>(rng, assign, sum, optional) ? "OK" : "Mismatch!") << '\n';
+    cout << "RangeAddMin    : " << (Validate<RangeAddMinPolicy<int64_t>>(rng, add, minOf, plain) ? "OK" : "Mismatch!") << '\n';
+    cout << "RangeAssignMax : " << (Validate<RangeAssignMaxPolicy<int64_t>>(rng, assign, maxOf, optional) ? "OK" : "Mismatch!") << "\n\n";
+}
+
+struct Operation
+{
+    size_t  left;
+    size_t  right;
+    int64_t value;
+};
+
+int main()
+{
+    RunValidation();
+
+    mt19937 rng{ 2 };
+
+    uniform_int_distribution<size_t>  indexDist{ 0, kSize };
+    uniform_int_distribution<int64_t> valueDist{ -1'000, 1'000 };
+
+    vector<int64_t> values(kSize);
+
+    for (int64_t& value : values)
+    {
+        value = valueDist(rng);
+    }
+
+    // 짝수 번째는 갱신, 홀수 번째는 조회
+    vector<Operation> ops(kOpCount);
+
+    for (Operation& op : ops)
+    {
+        op.left  = indexDist(rng);
+        op.right = indexDist(rng);
+        op.value = valueDist(rng);
+
+        if (op.left > op.right)
+        {
+            swap(op.left, op.right);
+        }
+
+        op.left = min(op.left, kSize - 1);
+    }
+
+    cout << "n : " << kSize << ", operations : " << kOpCount << '\n';
+
+    // 점 갱신 + 구간 합
+    {
+        FenwickTree<int64_t>                       fenwick{ span<const int64_t>{ values } };
+        LazySegmentTree<RangeAddSumPolicy<int64_t>> segment{ span<const int64_t>{ values } };
+
+        int64_t fenwickChecksum = 0;
+        int64_t segmentChecksum = 0;
+
+        double fenwickTime = Measure([&] {
+            for (size_t idx = 0; idx < kOpCount; idx++)
+            {
+                const Operation& op = ops[idx];
+
+                if (0 == idx % 2)
+                {
+                    fenwick.Update(op.left, op.value);
+                }
+                else
+                {
+                    fenwickChecksum += fenwick.Range(op.left, op.right);
+                }
+            }
+        });
+
+        double segmentTime = Measure([&] {
+            for (size_t idx = 0; idx < kOpCount; idx++)
+            {
+                const Operation& op = ops[idx];
+
+                if (0 == idx % 2)
+                {
+                    segment.Apply(op.left, op.left + 1, op.value);
+                }
+                else
+                {
+                    segmentChecksum += segment.Query(op.left, op.right);
+                }
+            }
+        });
+
+        cout << "Point update + range sum - FenwickTree : " << fenwickTime << "s"
+             << ", LazySegmentTree : " << segmentTime << "s"
+             << (fenwickChecksum == segmentChecksum ? "" : " (Mismatch!)") << '\n';
+    }
+
+    // 구간 갱신 + 구간 합
+    {
+        RangeFenwickTree<int64_t>                   fenwick{ kSize };
+        LazySegmentTree<RangeAddSumPolicy<int64_t>> segment{ span<const int64_t>{ values } };
+
+        for (size_t idx = 0; idx < kSize; idx++)
+        {
+            fenwick.Add(idx, idx + 1, values[idx]);
+        }
+
+        int64_t fenwickChecksum = 0;
+        int64_t segmentChecksum = 0;
+
+        double fenwickTime = Measure([&] {
+            for (size_t idx = 0; idx < kOpCount; idx++)
+            {
+                const Operation& op = ops[idx];
+
+                if (0 == idx % 2)
+                {
+                    fenwick.Add(op.left, op.right, op.value);
+                }
+                else
+                {
+                    fenwickChecksum += fenwick.Range(op.left, op.right);
+                }
+            }
+        });
+
+        double segmentTime = Measure([&] {
+            for (size_t idx = 0; idx < kOpCount; idx++)
+            {
+                const Operation& op = ops[idx];
+
+                if (0 == idx % 2)
+                {
+                    segment.Apply(op.left, op.right, op.value);
+                }
+                else
+                {
+                    segmentChecksum += segment.Query(op.left, op.right);
+                }
+            }
+        });
+
+        cout << "Range update + range sum - RangeFenwickTree : " << fenwickTime << "s"
+             << ", LazySegmentTree : " << segmentTime << "s"
+             << (fenwickChecksum == segmentChecksum ? "" : " (Mismatch!)") << '\n';
+    }
+
+    return 0;
+}
@@ -1,5 +1,7 @@
 #include <bits/stdc++.h>
 
+#include "DisjointSet.h"
+
 using namespace std;
 
 // 신장 트리(Spanning Tree)
@@ -52,37 +54,12 @@ int b;
 int c;
 
 priority_queue<Edge, vector<Edge>, Comp> edges;
-int ufSet[10004];
-
-int res;
-
-int doFind(int here)
-{
-    // 루트 노드(분리집합의 대표 원소)
-    if (here == ufSet[here])
-        return here;
-
-    // 최적화(경로 압축)
-    ufSet[here] = doFind(ufSet[here]);
 
-    return ufSet[here];
-}
+// 분리 집합은 DisjointSet.h로 옮겼다(크기에 의한 합치기 + 반복문 방식의 경로 절반).
+// 예전의 doFind()와 doUnion()은 각각 Find()와 Union()에 해당한다.
+DisjointSet ufSet;
 
-// a 집합을 b 집합에 연결
-bool doUnion(int a, int b)
-{
-    a = doFind(a);
-    b = doFind(b);
-
-    // 같은 집합에 속해 있음
-    if (a == b)
-        return false;
-
-    // 합집합(b 집합의 대표 원소를 a 집합의 대표 원소에 연결)
-    ufSet[b] = a;
-
-    return true;
-}
+int res;
 
 int main()
 {
@@ -92,11 +69,8 @@ int main()
 
     cin >> v >> e;
 
-    for (int i = 0; i < 10004; i++)
-    {
-        // 정점 별로 분리 집합 생성
-        ufSet[i] = i;
-    }
+    // 정점 별로 분리 집합 생성(정점 번호가 1부터 시작)
+    ufSet.Reset(v + 1);
 
     for (int i = 0; i < e; i++)
     {
@@ -112,7 +86,7 @@ int main()
 
         // cout << edge.weight << ' ';
 
-        if (true == doUnion(edge.v1, edge.v2))
+        if (true == ufSet.Union(edge.v1, edge.v2))
         {
             res += edge.weight;
         }
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <bit>
+#include <vector>
+#include <utility>
+
+// 단조 우선순위 큐(Monotone Priority Queue)
+// : 꺼내는 키가 절대로 감소하지 않는다는 조건을 활용하는 우선순위 큐
+//
+// 음이 아닌 가중치를 사용하는 다익스트라에서는 꺼낸 정점의 비용이 단조 증가한다.
+// 그리고 새로 넣는 키는 항상 (마지막으로 꺼낸 키) 이상이다.
+// 이 조건을 만족하면 비교 기반 힙을 쓰지 않고도 우선순위 큐를 만들 수 있다.
+//
+// 두 큐 모두 std::priority_queue를 사용한 다익스트라처럼 같은 정점이 여러 번 들어갈 수 있으며(lazy deletion)
+// 꺼낸 키가 현재 비용보다 크면 무시하는 방식으로 사용한다.
+//
+// 인터페이스
+// - Push(key, id)
+// - Pop() -> { key, id }
+// - Empty()
+
+// 래딕스 힙(Radix Heap)
+// : 마지막으로 꺼낸 키(_last)와 XOR했을 때 가장 높은 비트의 위치를 기준으로 버킷을 나눈다.
+//
+// bucket[0]  : key == _last
+// bucket[i]  : 2^(i - 1) <= (key ^ _last) < 2^i
+//
+// bucket[0]이 비었을 때만 비어 있지 않은 첫 번째 버킷에서 최솟값을 찾아 _last로 삼고 원소들을 다시 분배한다.
+// 원소는 _last가 증가할 때마다 더 낮은 버킷으로만 이동하기 때문에 원소 하나가 이동하는 횟수는 최대 (키의 비트 수)번이다.
+// -> 비교 없이 연산 당 분할 상환 O(log C) (C : 키의 최댓값)
+class RadixHeap
+{
+    static constexpr int kBucketCount = 33;
+
+public:
+    void Push(uint32_t key, int id)
+    {
+        _buckets[bucketIndex(key ^ _last)].push_back({ key, id });
+        _count++;
+    }
+
+    std::pair<uint32_t, int> Pop()
+    {
+        if (_buckets[0].empty())
+        {
+            this->redistribute();
+        }
+
+        std::pair<uint32_t, int> top = _buckets[0].back();
+        _buckets[0].pop_back();
+        _count--;
+
+        return top;
+    }
+
+public:
+    bool   Empty() const { return 0 == _count; }
+    size_t Count() const { return _count; }
+
+private:
+    static int bucketIndex(uint32_t diff)
+    {
+        return 0 == diff ? 0 : 32 - std::countl_zero(diff);
+    }
+
+    void redistribute()
+    {
+        int idx = 1;
+
+        while (_buckets[idx].empty())
+        {
+            idx++;
+        }
+
+        uint32_t newLast = _buckets[idx][0].first;
+
+        for (const auto& [key, id] : _buckets[idx])
+        {
+            newLast = key < newLast ? key : newLast;
+        }
+
+        _last = newLast;
+
+        // 더 낮은 버킷으로 이동(최솟값은 bucket[0]으로 들어감)
+        for (const auto& item : _buckets[idx])
+        {
+            _buckets[bucketIndex(item.first ^ _last)].push_back(item);
+        }
+
+        _buckets[idx].clear();
+    }
+
+private:
+    std::vector<std::pair<uint32_t, int>> _buckets[kBucketCount];
+
+    uint32_t _last  = 0;
+    size_t   _count = 0;
+};
+
+// 다이얼 버킷 큐(Dial's Bucket Queue)
+// : 키 값 자체를 버킷의 인덱스로 사용하는 방식
+//
+// 간선 가중치의 최댓값이 C라면 큐 안의 키는 항상 [_cur, _cur + C] 범위에 있다.
+// 따라서 (C + 1)개의 버킷을 원형으로 돌려 쓰면 된다.
+//
+// Push()는 O(1), Pop()은 빈 버킷을 건너뛰는 비용만 든다(전체 O(E + V * C)).
+// 가중치의 최댓값이 작을 때(격자 지도, 홉 수 기반 비용 등) 가장 빠르다.
+class BucketQueue
+{
+public:
+    explicit BucketQueue(uint32_t maxWeight)
+        : _buckets(maxWeight + 1)
+    { }
+
+public:
+    void Push(uint32_t key, int id)
+    {
+        _buckets[key % _buckets.size()].push_back(id);
+        _count++;
+    }
+
+    std::pair<uint32_t, int> Pop()
+    {
+        while (_buckets[_cur % _buckets.size()].empty())
+        {
+            _cur++;
+        }
+
+        std::vector<int>& bucket = _buckets[_cur % _buckets.size()];
+
+        int id = bucket.back();
+        bucket.pop_back();
+        _count--;
+
+        return { _cur, id };
+    }
+
+public:
+    bool   Empty() const { return 0 == _count; }
+    size_t Count() const { return _count; }
+
+private:
+    std::vector<std::vector<int>> _buckets;
+
+    uint32_t _cur   = 0;
+    size_t   _count = 0;
+};
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <deque>
+#include <algorithm>
+
+#include "../CSRGraph.h"
+
+// 벨만-포드의 변형들과 음의 사이클 추출
+//
+// BellmanFord.cpp는 모든 간선을 항상 (V - 1)번 확인한다.
+// 하지만 대부분의 그래프는 몇 번만 돌아도 더 이상 갱신이 일어나지 않는다.
+//
+// 1. BellmanFordPasses(earlyExit = true)
+//    : 한 번의 패스에서 아무것도 갱신되지 않았다면 그 이후의 패스도 마찬가지이기 때문에 바로 종료한다.
+//
+// 2. SPFA(Shortest Path Faster Algorithm)
+//    : 거리가 바뀐 정점의 간선만 다시 확인하면 된다는 점을 이용해서 갱신된 정점을 큐에 넣고 처리한다.
+//      큐가 비면 더 이상 갱신될 정점이 없으므로 종료한다(패스 단위의 조기 종료와 같은 의미).
+//
+//      SLF(Small Label First)
+//      : 새로 넣는 정점의 거리가 큐의 맨 앞 정점보다 작으면 덱의 앞쪽에 넣는다.
+//        거리가 작은 정점을 먼저 처리하면 다익스트라처럼 확정에 가까운 값을 먼저 퍼뜨리게 되어 재갱신이 줄어든다.
+//
+// 음의 사이클 추출
+// : 각 정점의 최단 경로에 포함된 간선 수(length)를 같이 기록한다.
+//   음의 사이클이 없다면 최단 경로의 간선 수는 (V - 1)을 넘을 수 없으니 length가 V에 도달하면 음의 사이클을 의심한다.
+//   하지만 length는 갱신할 때 한 번 기록하는 값이라서 조상의 부모가 나중에 바뀌면 실제 깊이보다 커질 수 있다.
+//   그래서 length가 V에 도달하면 그 정점에서 부모 포인터를 따라가면서 이미 지나간 정점을 다시 만나는지 확인한다.
+//   - 다시 만나면 부모 그래프에 사이클이 있는 것이고 이런 사이클은 항상 음의 사이클이다.
+//   - 출발점(부모가 -1)에 도착하면 사이클이 아니므로 length를 실제 깊이로 고치고 계속 진행한다.
+//
+// 음의 사이클이 있다면 dist는 의미가 없고 negativeCycle에 사이클의 정점이 진행 순서대로 들어간다.
+
+constexpr int64_t kBellmanFordInf = std::numeric_limits<int64_t>::max();
+
+struct BellmanFordResult
+{
+    std::vector<int64_t> dist;
+    std::vector<int>     parent;
+
+    std::vector<int> negativeCycle; // 비어 있으면 음의 사이클 없음
+
+    int64_t relaxations = 0; // 확인한 간선 수
+    int     passes      = 0; // 패스 방식에서 실행한 패스 수
+};
+
+// v에서 부모 포인터를 따라가다가 이미 지나간 정점을 다시 만나면 그 사이클을 구한다.
+// 출발점(부모가 -1)에 도착하면 사이클이 없는 것이므로 빈 배열을 반환하고 depth에 v의 실제 깊이(간선 수)를 기록한다.
+// mark는 정점 수 크기의 임시 배열이며 호출할 때마다 다른 stamp를 넘기면 매번 초기화할 필요가 없다.
+inline std::vector<int> ExtractNegativeCycle(const std::vector<int>& parent, int v, std::vector<int>& mark, int stamp, int* depth = nullptr)
+{
+    int cur   = v;
+    int steps = 0;
+
+    while (-1 != cur && stamp != mark[cur])
+    {
+        mark[cur] = stamp;
+
+        cur = parent[cur];
+        steps++;
+    }
+
+    std::vector<int> cycle;
+
+    if (-1 == cur)
+    {
+        if (nullptr != depth)
+        {
+            *depth = steps - 1;
+        }
+
+        return cycle;
+    }
+
+    // cur은 사이클 안의 정점이다.
+    int start = cur;
+
+    do
+    {
+        cycle.push_back(cur);
+        cur = parent[cur];
+    } while (cur != start);
+
+    // 부모 방향으로 모았으니 뒤집어서 간선 방향에 맞춘다.
+    std::reverse(cycle.begin(), cycle.end());
+
+    return cycle;
+}
+
+inline std::vector<int> ExtractNegativeCycle(const std::vector<int>& parent, int v)
+{
+    std::vector<int> mark(parent.size(), -1);
+
+    return ExtractNegativeCycle(parent, v, mark, 0);
+}
+
+// 조기 종료가 없는 방식(BellmanFord.cpp와 동일, 비교용)
+// 조기 종료를 원하면 earlyExit를 true로 지정한다.
+inline BellmanFordResult BellmanFordPasses(const CSRGraph<int>& graph, int source, bool earlyExit)
+{
+    int vertexCount = graph.VertexCount();
+
+    BellmanFordResult result;
+
+    result.dist.assign(vertexCount, kBellmanFordInf);
+    result.parent.assign(vertexCount, -1);
+
+    result.dist[source] = 0;
+
+    auto relaxAll = [&]() {
+        int lastUpdated = -1;
+
+        for (int from = 0; from < vertexCount; from++)
+        {
+            if (kBellmanFordInf == result.dist[from])
+                continue;
+
+            for (size_t idx = graph.Begin(from); idx < graph.End(from); idx++)
+            {
+                int     to       = graph.Target(idx);
+                int64_t nextDist = result.dist[from] + graph.Weight(idx);
+
+                result.relaxations++;
+
+                if (nextDist < result.dist[to])
+                {
+                    result.dist[to]   = nextDist;
+                    result.parent[to] = from;
+
+                    lastUpdated = to;
+                }
+            }
+        }
+
+        return lastUpdated;
+    };
+
+    for (int i = 0; i < vertexCount - 1; i++)
+    {
+        result.passes++;
+
+        if (-1 == relaxAll() && true == earlyExit)
+            return result;
+    }
+
+    // 한 번 더 갱신이 일어난다면 음의 사이클이 있다.
+    int lastUpdated = relaxAll();
+
+    result.passes++;
+
+    if (-1 != lastUpdated)
+    {
+        result.negativeCycle = ExtractNegativeCycle(result.parent, lastUpdated);
+    }
+
+    return result;
+}
+
+// SPFA + SLF
+// 여러 출발점의 거리를 모두 0으로 두고 시작한다.
+// 모든 정점을 넣으면 모든 정점으로 가중치 0인 간선을 가진 가상의 정점에서 시작한 것과 같다(존슨 알고리즘의 포텐셜).
+inline BellmanFordResult BellmanFordSPFA(const CSRGraph<int>& graph, const std::vector<int>& sources)
+{
+    int vertexCount = graph.VertexCount();
+
+    BellmanFordResult result;
+
+    result.dist.assign(vertexCount, kBellmanFordInf);
+    result.parent.assign(vertexCount, -1);
+
+    std::vector<int>  length(vertexCount, 0);
+    std::vector<bool> inQueue(vertexCount, false);
+
+    // 사이클 확인용(ExtractNegativeCycle() 참고)
+    std::vector<int> mark(vertexCount, -1);
+    int              stamp = 0;
+
+    std::deque<int> queue;
+
+    for (int source : sources)
+    {
+        if (true == inQueue[source])
+            continue;
+
+        result.dist[source] = 0;
+
+        queue.push_back(source);
+        inQueue[source] = true;
+    }
+
+    while (false == queue.empty())
+    {
+        int from = queue.front();
+        queue.pop_front();
+
+        inQueue[from] = false;
+
+        for (size_t idx = graph.Begin(from); idx < graph.End(from); idx++)
+        {
+            int     to       = graph.Target(idx);
+            int64_t nextDist = result.dist[from] + graph.Weight(idx);
+
+            result.relaxations++;
+
+            if (nextDist >= result.dist[to])
+                continue;
+
+            result.dist[to]   = nextDist;
+            result.parent[to] = from;
+
+            length[to] = length[from] + 1;
+
+            // 간선이 V개 이상인 최단 경로는 음의 사이클을 지난다(length가 오래된 값이 아니라면).
+            if (length[to] >= vertexCount)
+            {
+                result.negativeCycle = ExtractNegativeCycle(result.parent, to, mark, stamp++, &length[to]);
+
+                if (false == result.negativeCycle.empty())
+                    return result;
+            }
+
+            if (true == inQueue[to])
+                continue;
+
+            inQueue[to] = true;
+
+            // SLF
+            if (false == queue.empty() && nextDist < result.dist[queue.front()])
+            {
+                queue.push_front(to);
+            }
+            else
+            {
+                queue.push_back(to);
+            }
+        }
+    }
+
+    return result;
+}
+
+inline BellmanFordResult BellmanFordSPFA(const CSRGraph<int>& graph, int source)
+{
+    return BellmanFordSPFA(graph, std::vector<int>{ source });
+}
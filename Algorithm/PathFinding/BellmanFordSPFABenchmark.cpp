@@ -0,0 +1,242 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "../CSRGraph.h"
+#include "../GraphGenerator.h"
+#include "BellmanFordSPFA.h"
+
+// BellmanFordSPFA.h의 변형들 비교
+//
+// 1. 음의 가중치가 섞인 희소 그래프에서 전체 패스 방식, 조기 종료, SPFA(SLF)의 시간과 간선 확인 횟수 측정
+// 2. 음의 사이클을 넣었을 때 추출한 사이클이 실제로 존재하고 가중치 합이 음수인지 검증
+// 3. 작은 랜덤 그래프 100만 개(출발점 하나, 모든 정점이 출발점)에서 SPFA와 패스 방식의 음의 사이클 판정이 같은지,
+//    SPFA가 찾은 사이클이 닫혀 있고 가중치 합이 음수인지 검증(length가 오래된 값일 때 사이클 추출이 실패하는 경우 확인)
+//
+// 음의 사이클이 없으면서 음의 간선이 있는 그래프는 GraphGenerator.h의 MakeNegativeWeightGraph()로 만든다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+void RunComparison(int vertexCount, size_t edgeCount, bool runFullPass)
+{
+    vector<GraphEdge> edges = MakeNegativeWeightGraph(vertexCount, edgeCount);
+
+    size_t negativeEdges = 0;
+
+    for (const GraphEdge& edge : edges)
+    {
+        negativeEdges += (edge.weight < 0);
+    }
+
+    CSRGraph<int> graph{ vertexCount, edges };
+
+    cout << "V : " << vertexCount << ", E : " << graph.EdgeCount() << ", Negative edges : " << negativeEdges << '\n';
+
+    BellmanFordResult earlyExit;
+    BellmanFordResult spfa;
+
+    double earlyExitTime = Measure([&] { earlyExit = BellmanFordPasses(graph, 0, true); });
+    double spfaTime      = Measure([&] { spfa = BellmanFordSPFA(graph, 0); });
+
+    if (true == runFullPass)
+    {
+        BellmanFordResult fullPass;
+
+        double fullPassTime = Measure([&] { fullPass = BellmanFordPasses(graph, 0, false); });
+
+        cout << "Full pass  : " << fullPassTime << "s, passes : " << fullPass.passes << ", relaxations : " << fullPass.relaxations
+             << (fullPass.dist == spfa.dist ? "" : " (Mismatch!)") << '\n';
+    }
+
+    cout << "Early exit : " << earlyExitTime << "s, passes : " << earlyExit.passes << ", relaxations : " << earlyExit.relaxations
+         << (earlyExit.dist == spfa.dist ? "" : " (Mismatch!)") << '\n';
+
+    cout << "SPFA (SLF) : " << spfaTime << "s, relaxations : " << spfa.relaxations << "\n\n";
+}
+
+// 추출한 사이클이 실제 간선으로 이어져 있는지 확인하고 가중치 합을 구한다.
+bool VerifyCycle(const CSRGraph<int>& graph, const vector<int>& cycle, int64_t* cost)
+{
+    *cost = 0;
+
+    for (size_t idx = 0; idx < cycle.size(); idx++)
+    {
+        int from = cycle[idx];
+        int to   = cycle[(idx + 1) % cycle.size()];
+
+        int64_t best = kBellmanFordInf;
+
+        for (size_t edge = graph.Begin(from); edge < graph.End(from); edge++)
+        {
+            if (to == graph.Target(edge))
+            {
+                best = min<int64_t>(best, graph.Weight(edge));
+            }
+        }
+
+        if (kBellmanFordInf == best)
+            return false;
+
+        *cost += best;
+    }
+
+    return true;
+}
+
+void PrintCycle(const char* name, const CSRGraph<int>& graph, const BellmanFordResult& result, double elapsed)
+{
+    int64_t cost    = 0;
+    bool    isValid = (false == result.negativeCycle.empty()) && VerifyCycle(graph, result.negativeCycle, &cost) && cost < 0;
+
+    cout << name << " : " << elapsed << "s, cycle length : " << result.negativeCycle.size() << ", cycle cost : " << cost
+         << (isValid ? "" : " (Invalid!)") << '\n';
+}
+
+void RunNegativeCycle(int vertexCount, size_t edgeCount)
+{
+    vector<GraphEdge> edges = MakeNegativeWeightGraph(vertexCount, edgeCount, 7);
+
+    // 멀리 떨어진 정점 몇 개를 음의 사이클로 묶는다.
+    int a = vertexCount / 2;
+    int b = vertexCount / 2 + 100;
+    int c = vertexCount / 2 + 200;
+
+    edges.push_back({ a, b, -1'000 });
+    edges.push_back({ b, c, -1'000 });
+    edges.push_back({ c, a, -1'000 });
+
+    CSRGraph<int> graph{ vertexCount, edges };
+
+    BellmanFordResult earlyExit;
+    BellmanFordResult spfa;
+
+    double earlyExitTime = Measure([&] { earlyExit = BellmanFordPasses(graph, 0, true); });
+    double spfaTime      = Measure([&] { spfa = BellmanFordSPFA(graph, 0); });
+
+    PrintCycle("Early exit", graph, earlyExit, earlyExitTime);
+    PrintCycle("SPFA (SLF)", graph, spfa, spfaTime);
+}
+
+// SPFA의 음의 사이클 판정을 패스 방식과 비교하고 찾은 사이클이 닫혀 있으며 가중치 합이 음수인지 확인한다.
+// sources가 모든 정점이라면 모든 정점으로 가중치 0인 간선을 가진 가상의 정점에서 패스 방식을 실행해서 비교한다.
+bool CheckNegativeCycle(int vertexCount, const vector<GraphEdge>& edges, const vector<int>& sources, bool* hasCycle)
+{
+    CSRGraph<int> graph{ vertexCount, edges };
+
+    BellmanFordResult spfa = BellmanFordSPFA(graph, sources);
+    BellmanFordResult passes;
+
+    if (1 == sources.size())
+    {
+        passes = BellmanFordPasses(graph, sources[0], true);
+    }
+    else
+    {
+        vector<GraphEdge> withSource = edges;
+
+        for (int v = 0; v < vertexCount; v++)
+        {
+            withSource.push_back({ vertexCount, v, 0 });
+        }
+
+        passes = BellmanFordPasses(CSRGraph<int>{ vertexCount + 1, withSource }, vertexCount, true);
+    }
+
+    *hasCycle = (false == spfa.negativeCycle.empty());
+
+    if (*hasCycle != (false == passes.negativeCycle.empty()))
+        return false;
+
+    if (false == *hasCycle)
+        return 1 != sources.size() || spfa.dist == passes.dist;
+
+    int64_t cost = 0;
+
+    return VerifyCycle(graph, spfa.negativeCycle, &cost) && cost < 0;
+}
+
+// 작은 랜덤 그래프에서 음의 사이클 추출 검증
+// length가 오래된 값이라서 부모 포인터가 출발점(-1)으로 이어지는 경우가 드물게 생기기 때문에 많이 돌린다.
+void RunRandomNegativeCycles(int graphCount)
+{
+    // 부모를 따라가다가 출발점(-1)에 도착하는 그래프(출발점 0)
+    vector<GraphEdge> known = {
+        { 1, 2, 1 }, { 2, 5, -1 }, { 3, 2, 3 }, { 3, 0, 7 }, { 2, 5, 8 }, { 3, 2, 9 }, { 5, 3, -6 }, { 3, 1, 1 },
+        { 0, 4, 13 }, { 1, 2, 3 }, { 5, 2, 3 }, { 3, 2, 12 }, { 4, 3, -1 }, { 4, 5, -6 }, { 2, 3, -1 }, { 0, 1, 10 }
+    };
+
+    bool hasCycle = false;
+    bool isValid  = CheckNegativeCycle(6, known, { 0 }, &hasCycle) && hasCycle;
+
+    mt19937 rng{ 11 };
+    uniform_int_distribution<int> vertexCountDist{ 2, 7 };
+    uniform_int_distribution<int> edgeCountDist{ 0, 19 };
+    uniform_int_distribution<int> weightDist{ -6, 13 };
+
+    int cycles = 0;
+
+    for (int i = 0; i < graphCount && isValid; i++)
+    {
+        int vertexCount = vertexCountDist(rng);
+        int edgeCount   = edgeCountDist(rng);
+
+        uniform_int_distribution<int> vertexDist{ 0, vertexCount - 1 };
+
+        vector<GraphEdge> edges(edgeCount);
+
+        for (GraphEdge& edge : edges)
+        {
+            edge = { vertexDist(rng), vertexDist(rng), weightDist(rng) };
+        }
+
+        vector<int> allSources(vertexCount);
+
+        for (int v = 0; v < vertexCount; v++)
+        {
+            allSources[v] = v;
+        }
+
+        isValid = isValid && CheckNegativeCycle(vertexCount, edges, { 0 }, &hasCycle);
+        cycles += hasCycle;
+
+        isValid = isValid && CheckNegativeCycle(vertexCount, edges, allSources, &hasCycle);
+        cycles += hasCycle;
+    }
+
+    cout << "Random graphs : " << graphCount << " (single source + all sources), negative cycles : " << cycles
+         << (isValid ? "" : " (Invalid!)") << '\n';
+}
+
+int main()
+{
+    // 전체 패스 방식은 V * E라서 작은 그래프에서만 돌린다.
+    RunComparison(5'000, 20'000, true);
+    RunComparison(200'000, 800'000, false);
+
+    // 음의 사이클이 있으면 패스 방식은 조기 종료가 불가능하므로 마찬가지로 작은 그래프를 쓴다.
+    cout << "Negative cycle\n";
+
+    RunNegativeCycle(5'000, 20'000);
+    RunRandomNegativeCycles(1'000'000);
+
+    return 0;
+}
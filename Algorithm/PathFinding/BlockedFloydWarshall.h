@@ -0,0 +1,473 @@
+#pragma once
+
+#include <cstdint>
+#include <new>
+#include <memory>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+#include "../ThreadPool.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// 블록(타일) 단위 플로이드 워셜
+//
+// FloydWarshall.cpp의 k-i-j 삼중 반복문은 k마다 행렬 전체를 훑기 때문에
+// 행렬이 캐시보다 커지는 순간 매번 메모리에서 다시 읽어와야 한다.
+//
+// 블록 방식은 행렬을 B x B 크기의 타일로 나누고 k 블록마다 다음 3단계를 처리한다.
+//
+//   1단계 : 대각 타일(kb, kb)를 일반적인 플로이드 워셜로 갱신
+//   2단계 : kb 행의 타일(kb, j)와 kb 열의 타일(i, kb)를 대각 타일을 사용해 갱신
+//   3단계 : 나머지 타일(i, j)를 (i, kb)와 (kb, j)를 사용해 갱신
+//
+//   +---+---+---+
+//   | 3 | 2 | 3 |
+//   +---+---+---+
+//   | 2 | 1 | 2 |   (kb = 1일 때)
+//   +---+---+---+
+//   | 3 | 2 | 3 |
+//   +---+---+---+
+//
+// 모든 단계가 C = min(C, A + B) 형태의 min-plus 연산이고 한 번에 타일 3개만 보기 때문에 캐시 안에서 처리된다.
+// 3단계의 타일들은 서로 독립적이라 병렬화하기도 좋다.
+//
+// INF 처리
+// : 벡터 연산에서는 분기를 쓸 수 없기 때문에 INF + w가 오버플로우 나지 않아야 한다.
+//   INF를 int32_t 최댓값의 절반 정도로 잡으면 (INF + INF)도 표현할 수 있고
+//   덧셈 결과를 INF로 잘라내면(saturating add) INF를 거친 경로는 항상 INF로 남는다.
+//   음의 가중치가 있어도 INF + (음수)가 INF보다 작아지지 않도록 B 쪽이 INF인 경우는 따로 INF로 고정한다.
+//   (A 쪽이 INF인 경우는 행 전체를 건너뛴다.)
+//
+// AVX2 옵션(/arch:AVX2, -mavx2)을 켜고 빌드하면 8개의 원소를 한 번에 처리하는 커널을 사용한다.
+// 옵션이 없다면 컴파일러가 자동 벡터화할 수 있는 형태의 스칼라 루프를 사용한다.
+//
+// 병렬화
+// : 1단계는 타일 하나뿐이라 순차적으로 처리하고
+//   2단계(행과 열의 타일)와 3단계(나머지 타일)는 타일끼리 서로 독립적이기 때문에 ThreadPool로 나눠서 처리한다.
+//   단계 사이에는 ParallelFor()가 반환되는 시점이 동기화 지점 역할을 한다.
+//
+// 경로 복원(next-hop 행렬)
+// : next[i][j]는 i에서 j로 가는 최단 경로에서 i 다음에 방문할 정점이다.
+//   dist[i][j]가 k를 거치는 경로로 갱신될 때 next[i][j] = next[i][k]로 같이 갱신하면
+//   플로이드 워셜을 다시 돌리지 않고도 i -> next[i][j] -> ... -> j를 따라가서 경로를 만들 수 있다.
+//   정점이 65536개 미만이라면 uint16_t 인덱스로 충분하기 때문에 행렬의 크기를 int32_t 대비 절반으로 줄일 수 있다.
+
+constexpr int32_t kDistInf = 0x3FFF'FFFF;
+
+// 행렬의 크기는 실행 중에 정하고 각 행은 캐시 라인(64바이트) 경계에 맞춘다.
+// 한 변의 길이(stride)는 블록 크기의 배수로 올림해서 마지막 타일도 꽉 찬 타일로 처리한다.
+template <typename T>
+class AlignedMatrix
+{
+public:
+    static constexpr int    kBlockSize = 64;
+    static constexpr size_t kAlignment = 64;
+
+private:
+    struct AlignedDeleter
+    {
+        void operator()(T* ptr) const
+        {
+            ::operator delete[](ptr, std::align_val_t{ kAlignment });
+        }
+    };
+
+public:
+    AlignedMatrix() = default;
+
+    AlignedMatrix(int size, T fillValue)
+        : _size{ size }, _stride{ (size + kBlockSize - 1) / kBlockSize * kBlockSize }
+    {
+        size_t count = (size_t)_stride * _stride;
+
+        _data.reset(static_cast<T*>(::operator new[](count * sizeof(T), std::align_val_t{ kAlignment })));
+
+        std::fill(_data.get(), _data.get() + count, fillValue);
+    }
+
+    AlignedMatrix(const AlignedMatrix& rhs)
+        : AlignedMatrix(rhs._size, T{ })
+    {
+        std::copy(rhs._data.get(), rhs._data.get() + (size_t)_stride * _stride, _data.get());
+    }
+
+    AlignedMatrix& operator=(const AlignedMatrix& rhs)
+    {
+        if (this != &rhs)
+        {
+            AlignedMatrix temp{ rhs };
+
+            *this = std::move(temp);
+        }
+
+        return *this;
+    }
+
+    AlignedMatrix(AlignedMatrix&&) noexcept = default;
+    AlignedMatrix& operator=(AlignedMatrix&&) noexcept = default;
+
+public:
+    int Size() const   { return _size; }
+    int Stride() const { return _stride; }
+
+    T&       At(int i, int j)       { return _data[(size_t)i * _stride + j]; }
+    const T& At(int i, int j) const { return _data[(size_t)i * _stride + j]; }
+
+    T*       Row(int i)       { return _data.get() + (size_t)i * _stride; }
+    const T* Row(int i) const { return _data.get() + (size_t)i * _stride; }
+
+    T*       Data()       { return _data.get(); }
+    const T* Data() const { return _data.get(); }
+
+    // 타일의 왼쪽 위 원소
+    size_t TileOffset(int bi, int bj) const { return (size_t)bi * kBlockSize * _stride + (size_t)bj * kBlockSize; }
+
+    T* Tile(int bi, int bj) { return _data.get() + TileOffset(bi, bj); }
+
+    bool operator==(const AlignedMatrix& rhs) const
+    {
+        if (_size != rhs._size)
+            return false;
+
+        for (int i = 0; i < _size; i++)
+        {
+            if (false == std::equal(Row(i), Row(i) + _size, rhs.Row(i)))
+                return false;
+        }
+
+        return true;
+    }
+
+private:
+    int _size   = 0;
+    int _stride = 0;
+
+    std::unique_ptr<T[], AlignedDeleter> _data;
+};
+
+// 늘어난 부분은 간선이 없는 정점처럼 취급하기 때문에 결과에 영향을 주지 않는다.
+class DistanceMatrix : public AlignedMatrix<int32_t>
+{
+public:
+    static constexpr int kBlockSize = AlignedMatrix<int32_t>::kBlockSize;
+
+public:
+    DistanceMatrix() = default;
+
+    explicit DistanceMatrix(int size)
+        : AlignedMatrix<int32_t>(size, kDistInf)
+    {
+        for (int i = 0; i < Stride(); i++)
+        {
+            At(i, i) = 0;
+        }
+    }
+
+public:
+    // 간선 추가(같은 간선이 여러 번 들어오면 가장 작은 값만 남김)
+    void AddEdge(int from, int to, int32_t weight)
+    {
+        At(from, to) = std::min(At(from, to), weight);
+    }
+};
+
+// next-hop 행렬
+// : 정점이 65536개 미만이라면 NextHopMatrix<uint16_t>, 그 이상이라면 NextHopMatrix<int32_t>를 사용한다.
+template <typename Index>
+class NextHopMatrix : public AlignedMatrix<Index>
+{
+public:
+    static constexpr Index kNone = std::numeric_limits<Index>::max();
+
+public:
+    NextHopMatrix() = default;
+
+    // 플로이드 워셜을 실행하기 전의 거리 행렬(간선 정보)로 초기화한다.
+    explicit NextHopMatrix(const DistanceMatrix& dist)
+        : AlignedMatrix<Index>(dist.Size(), kNone)
+    {
+        for (int i = 0; i < dist.Size(); i++)
+        {
+            for (int j = 0; j < dist.Size(); j++)
+            {
+                if (kDistInf != dist.At(i, j))
+                {
+                    this->At(i, j) = (Index)j;
+                }
+            }
+        }
+    }
+
+public:
+    // from -> to 경로(from과 to 포함), 경로가 없으면 빈 배열
+    std::vector<int> ReconstructPath(int from, int to) const
+    {
+        std::vector<int> path;
+
+        if (kNone == this->At(from, to))
+            return path;
+
+        path.push_back(from);
+
+        while (from != to)
+        {
+            from = this->At(from, to);
+
+            path.push_back(from);
+        }
+
+        return path;
+    }
+};
+
+// dst[j] = min(dst[j], a + src[j]) (a < INF)
+// hopDst가 있다면 값이 줄어든 위치에 hop을 기록한다.
+template <typename Index = void>
+inline void MinPlusRow(int32_t* dst, const int32_t* src, int32_t a, int count, Index* hopDst = nullptr, int32_t hop = 0)
+{
+    constexpr bool kHasNext = false == std::is_void_v<Index>;
+
+    int j = 0;
+
+#if defined(__AVX2__)
+    const __m256i inf = _mm256_set1_epi32(kDistInf);
+    const __m256i va  = _mm256_set1_epi32(a);
+
+    // saturating add : min(a + b, INF), b가 INF라면 INF
+    auto minPlus8 = [&](int offset) {
+        __m256i vb = _mm256_load_si256(reinterpret_cast<const __m256i*>(src + offset));
+        __m256i vc = _mm256_load_si256(reinterpret_cast<const __m256i*>(dst + offset));
+
+        __m256i sum = _mm256_min_epi32(_mm256_add_epi32(va, vb), inf);
+        sum = _mm256_blendv_epi8(sum, inf, _mm256_cmpeq_epi32(vb, inf));
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(dst + offset), _mm256_min_epi32(vc, sum));
+
+        // 값이 줄어든 위치
+        return _mm256_cmpgt_epi32(vc, sum);
+    };
+
+    if constexpr (false == kHasNext)
+    {
+        for (; j + 8 <= count; j += 8)
+        {
+            minPlus8(j);
+        }
+    }
+    else if constexpr (sizeof(Index) == 2)
+    {
+        const __m256i vhop = _mm256_set1_epi16((int16_t)hop);
+
+        for (; j + 16 <= count; j += 16)
+        {
+            __m256i mask0 = minPlus8(j);
+            __m256i mask1 = minPlus8(j + 8);
+
+            // 32비트 마스크 2개를 16비트 마스크 1개로 합친다.
+            // packs는 128비트 단위로 섞이기 때문에 permute로 순서를 바로잡는다.
+            __m256i mask = _mm256_permute4x64_epi64(_mm256_packs_epi32(mask0, mask1), 0xD8);
+
+            __m256i vn = _mm256_load_si256(reinterpret_cast<const __m256i*>(hopDst + j));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(hopDst + j), _mm256_blendv_epi8(vn, vhop, mask));
+        }
+    }
+    else if constexpr (sizeof(Index) == 4)
+    {
+        const __m256i vhop = _mm256_set1_epi32(hop);
+
+        for (; j + 8 <= count; j += 8)
+        {
+            __m256i mask = minPlus8(j);
+
+            __m256i vn = _mm256_load_si256(reinterpret_cast<const __m256i*>(hopDst + j));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(hopDst + j), _mm256_blendv_epi8(vn, vhop, mask));
+        }
+    }
+#endif
+
+    for (; j < count; j++)
+    {
+        int32_t sum = (kDistInf == src[j]) ? kDistInf : std::min(a + src[j], kDistInf);
+
+        if (sum < dst[j])
+        {
+            dst[j] = sum;
+
+            if constexpr (kHasNext)
+            {
+                hopDst[j] = (Index)hop;
+            }
+        }
+    }
+}
+
+// C = min(C, A + B) (모두 B x B 타일, 같은 타일을 가리켜도 됨)
+// k를 가장 바깥에 두어야 1, 2단계처럼 C가 A나 B와 같은 타일일 때도 플로이드 워셜의 순서가 유지된다.
+//
+// next-hop : dist[i][j]가 k를 거치도록 바뀌면 next[i][j] = next[i][k]
+template <typename Index = void>
+inline void MinPlusTile(int32_t* c, const int32_t* a, const int32_t* b, int stride, Index* nextC = nullptr, const Index* nextA = nullptr)
+{
+    constexpr int kBlock = DistanceMatrix::kBlockSize;
+
+    for (int k = 0; k < kBlock; k++)
+    {
+        const int32_t* bRow = b + (size_t)k * stride;
+
+        for (int i = 0; i < kBlock; i++)
+        {
+            int32_t aik = a[(size_t)i * stride + k];
+
+            // INF를 거치는 경로는 볼 필요가 없다.
+            if (aik >= kDistInf)
+                continue;
+
+            if constexpr (std::is_void_v<Index>)
+            {
+                MinPlusRow(c + (size_t)i * stride, bRow, aik, kBlock);
+            }
+            else
+            {
+                MinPlusRow(c + (size_t)i * stride, bRow, aik, kBlock, nextC + (size_t)i * stride, (int32_t)nextA[(size_t)i * stride + k]);
+            }
+        }
+    }
+}
+
+// 각 단계를 따로 호출할 수 있게 나눠 두었다(병렬화할 때 사용).
+// next는 next-hop 행렬의 시작 주소이며 거리 행렬과 같은 stride를 사용한다(nullptr이면 경로를 기록하지 않음).
+template <typename Index = void>
+inline void FloydWarshallPhase1(DistanceMatrix& dist, int kb, Index* next = nullptr)
+{
+    size_t diag = dist.TileOffset(kb, kb);
+
+    if constexpr (std::is_void_v<Index>)
+    {
+        MinPlusTile(dist.Data() + diag, dist.Data() + diag, dist.Data() + diag, dist.Stride());
+    }
+    else
+    {
+        MinPlusTile(dist.Data() + diag, dist.Data() + diag, dist.Data() + diag, dist.Stride(), next + diag, next + diag);
+    }
+}
+
+// kb 행과 kb 열에서 idx번째 타일(idx != kb)
+template <typename Index = void>
+inline void FloydWarshallPhase2(DistanceMatrix& dist, int kb, int idx, Index* next = nullptr)
+{
+    int32_t* data = dist.Data();
+
+    size_t diag = dist.TileOffset(kb, kb);
+    size_t row  = dist.TileOffset(kb, idx);
+    size_t col  = dist.TileOffset(idx, kb);
+
+    if constexpr (std::is_void_v<Index>)
+    {
+        MinPlusTile(data + row, data + diag, data + row, dist.Stride());
+        MinPlusTile(data + col, data + col, data + diag, dist.Stride());
+    }
+    else
+    {
+        MinPlusTile(data + row, data + diag, data + row, dist.Stride(), next + row, next + diag);
+        MinPlusTile(data + col, data + col, data + diag, dist.Stride(), next + col, next + col);
+    }
+}
+
+// 나머지 타일(bi != kb, bj != kb)
+template <typename Index = void>
+inline void FloydWarshallPhase3(DistanceMatrix& dist, int kb, int bi, int bj, Index* next = nullptr)
+{
+    int32_t* data = dist.Data();
+
+    size_t target = dist.TileOffset(bi, bj);
+    size_t col    = dist.TileOffset(bi, kb);
+    size_t row    = dist.TileOffset(kb, bj);
+
+    if constexpr (std::is_void_v<Index>)
+    {
+        MinPlusTile(data + target, data + col, data + row, dist.Stride());
+    }
+    else
+    {
+        MinPlusTile(data + target, data + col, data + row, dist.Stride(), next + target, next + col);
+    }
+}
+
+template <typename Index = void>
+inline void FloydWarshallBlocked(DistanceMatrix& dist, Index* next = nullptr)
+{
+    int blockCount = dist.Stride() / DistanceMatrix::kBlockSize;
+
+    for (int kb = 0; kb < blockCount; kb++)
+    {
+        FloydWarshallPhase1(dist, kb, next);
+
+        for (int idx = 0; idx < blockCount; idx++)
+        {
+            if (idx != kb)
+            {
+                FloydWarshallPhase2(dist, kb, idx, next);
+            }
+        }
+
+        for (int bi = 0; bi < blockCount; bi++)
+        {
+            if (bi == kb)
+                continue;
+
+            for (int bj = 0; bj < blockCount; bj++)
+            {
+                if (bj != kb)
+                {
+                    FloydWarshallPhase3(dist, kb, bi, bj, next);
+                }
+            }
+        }
+    }
+}
+
+template <typename Index = void>
+inline void FloydWarshallParallel(DistanceMatrix& dist, ThreadPool& pool, Index* next = nullptr)
+{
+    int blockCount = dist.Stride() / DistanceMatrix::kBlockSize;
+
+    for (int kb = 0; kb < blockCount; kb++)
+    {
+        FloydWarshallPhase1(dist, kb, next);
+
+        pool.ParallelFor(blockCount, [&](size_t idx) {
+            if ((int)idx != kb)
+            {
+                FloydWarshallPhase2(dist, kb, (int)idx, next);
+            }
+        });
+
+        pool.ParallelFor((size_t)blockCount * blockCount, [&](size_t idx) {
+            int bi = (int)(idx / blockCount);
+            int bj = (int)(idx % blockCount);
+
+            if (bi != kb && bj != kb)
+            {
+                FloydWarshallPhase3(dist, kb, bi, bj, next);
+            }
+        });
+    }
+}
+
+// next-hop 행렬을 같이 갱신하는 버전
+template <typename Index>
+inline void FloydWarshallBlocked(DistanceMatrix& dist, NextHopMatrix<Index>& next)
+{
+    FloydWarshallBlocked(dist, next.Data());
+}
+
+template <typename Index>
+inline void FloydWarshallParallel(DistanceMatrix& dist, NextHopMatrix<Index>& next, ThreadPool& pool)
+{
+    FloydWarshallParallel(dist, pool, next.Data());
+}
@@ -0,0 +1,93 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+#include "BlockedFloydWarshall.h"
+#include "DistanceMatrixGenerator.h"
+
+// FloydWarshall.cpp와 같은 k-i-j 방식과 BlockedFloydWarshall.h의 블록 방식 비교
+//
+// k-i-j 방식은 n이 커질수록 캐시 미스로 인해 급격히 느려지기 때문에 kNaiveMaxSize까지만 측정하고
+// 그 이후로는 블록 방식만 측정한다.
+//
+// !! 최적화 기능과 AVX2 옵션(/arch:AVX2, -mavx2)을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int kNaiveMaxSize = 1'024;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// FloydWarshall.cpp와 같은 방식(INF 검사만 추가)
+void FloydWarshallNaive(DistanceMatrix& dist)
+{
+    int n = dist.Size();
+
+    for (int k = 0; k < n; k++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if (kDistInf == dist.At(i, k))
+                continue;
+
+            for (int j = 0; j < n; j++)
+            {
+                if (kDistInf == dist.At(k, j))
+                    continue;
+
+                dist.At(i, j) = min(dist.At(i, j), dist.At(i, k) + dist.At(k, j));
+            }
+        }
+    }
+}
+
+int main()
+{
+#if defined(__AVX2__)
+    cout << "Kernel : AVX2\n\n";
+#else
+    cout << "Kernel : Scalar\n\n";
+#endif
+
+    for (int n : { 256, 512, 1'024, 2'048, 4'096 })
+    {
+        DistanceMatrix blocked = MakeRandomDistanceMatrix(n);
+
+        double blockedTime = Measure([&] { FloydWarshallBlocked(blocked); });
+
+        cout << "n : " << n << ", Blocked : " << blockedTime << "s";
+
+        if (n <= kNaiveMaxSize)
+        {
+            DistanceMatrix naive = MakeRandomDistanceMatrix(n);
+
+            double naiveTime = Measure([&] { FloydWarshallNaive(naive); });
+
+            cout << ", Naive : " << naiveTime << "s, speedup : " << naiveTime / blockedTime;
+
+            if (false == (naive == blocked))
+            {
+                cout << " (Mismatch!)";
+            }
+        }
+
+        cout << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,497 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <queue>
+#include <utility>
+#include <algorithm>
+
+#include "../CSRGraph.h"
+#include "ShortestPathQuery.h"
+
+// 축약 계층(Contraction Hierarchies)
+// : 정적인 그래프에 대해 한 번 전처리해 두고 최단 거리 쿼리를 아주 빠르게 처리하는 기법
+//
+// 전처리
+// 1. 정점에 중요도 순서(rank)를 매긴다.
+// 2. 중요도가 낮은 정점부터 하나씩 그래프에서 제거(축약)한다.
+// 3. 정점 v를 제거할 때 u -> v -> x가 u와 x 사이의 유일한 최단 경로라면
+//    경로가 사라지지 않도록 u -> x 지름길(shortcut)을 추가한다.
+//    v를 거치지 않는 더 짧거나 같은 경로(witness)가 있다면 지름길은 필요 없다.
+//
+// 쿼리
+// : 모든 최단 경로는 rank가 올라갔다가 내려오는 형태로 표현할 수 있다.
+//   그래서 출발지에서는 rank가 높아지는 간선만, 도착지에서는 역방향으로 rank가 높아지는 간선만 따라가는
+//   양방향 탐색을 하면 된다. 두 탐색 모두 그래프의 극히 일부만 보게 된다.
+//
+// 정점의 순서는 다음 값이 작은 정점부터 축약하는 방식으로 정한다(lazy update).
+// - edge difference : (추가될 지름길의 수) - (제거될 간선의 수)
+// - deleted neighbors : 이미 축약된 이웃의 수(축약이 그래프 전체에 고르게 퍼지게 함)
+// - level : 축약된 이웃의 level + 1 중 가장 큰 값(계층이 한쪽으로 깊어지는 것을 막음)
+//
+// witness 탐색은 확정하는 정점의 수를 제한한다.
+// 제한에 걸려서 witness를 못 찾으면 지름길을 추가하는데 불필요한 지름길이 생길 뿐 결과는 항상 정확하다.
+
+class ContractionHierarchy
+{
+public:
+    using Edge = CSRGraph<int>::Edge;
+
+public:
+    ContractionHierarchy() = default;
+
+    // upEdges   : u -> x (rank[u] < rank[x])
+    // downEdges : x -> u (원래 간선 u -> x에서 rank[u] > rank[x]인 것을 뒤집어서 저장)
+    ContractionHierarchy(std::vector<int> rank, const std::vector<Edge>& upEdges, const std::vector<Edge>& downEdges, size_t shortcutCount)
+        : _rank{ std::move(rank) }, _up{ (int)_rank.size(), upEdges }, _down{ (int)_rank.size(), downEdges }, _shortcutCount{ shortcutCount }
+    { }
+
+public:
+    // 파일 형식(모두 리틀 엔디언 바이너리 기준)
+    // [정점 수][지름길 수][up 간선 수][down 간선 수][rank 배열][up 간선 목록][down 간선 목록]
+    bool Save(const std::string& path) const
+    {
+        std::ofstream ofs{ path, std::ios::binary };
+
+        if (false == ofs.is_open())
+            return false;
+
+        int      vertexCount   = (int)_rank.size();
+        uint64_t shortcutCount = _shortcutCount;
+
+        std::vector<Edge> upEdges   = collectEdges(_up);
+        std::vector<Edge> downEdges = collectEdges(_down);
+
+        uint64_t upCount   = upEdges.size();
+        uint64_t downCount = downEdges.size();
+
+        ofs.write(reinterpret_cast<const char*>(&vertexCount), sizeof(vertexCount));
+        ofs.write(reinterpret_cast<const char*>(&shortcutCount), sizeof(shortcutCount));
+        ofs.write(reinterpret_cast<const char*>(&upCount), sizeof(upCount));
+        ofs.write(reinterpret_cast<const char*>(&downCount), sizeof(downCount));
+
+        ofs.write(reinterpret_cast<const char*>(_rank.data()), sizeof(int) * _rank.size());
+        ofs.write(reinterpret_cast<const char*>(upEdges.data()), sizeof(Edge) * upEdges.size());
+        ofs.write(reinterpret_cast<const char*>(downEdges.data()), sizeof(Edge) * downEdges.size());
+
+        return ofs.good();
+    }
+
+    bool Load(const std::string& path)
+    {
+        std::ifstream ifs{ path, std::ios::binary };
+
+        if (false == ifs.is_open())
+            return false;
+
+        int      vertexCount   = 0;
+        uint64_t shortcutCount = 0;
+        uint64_t upCount       = 0;
+        uint64_t downCount     = 0;
+
+        ifs.read(reinterpret_cast<char*>(&vertexCount), sizeof(vertexCount));
+        ifs.read(reinterpret_cast<char*>(&shortcutCount), sizeof(shortcutCount));
+        ifs.read(reinterpret_cast<char*>(&upCount), sizeof(upCount));
+        ifs.read(reinterpret_cast<char*>(&downCount), sizeof(downCount));
+
+        if (false == ifs.good() || vertexCount < 0)
+            return false;
+
+        std::vector<int>  rank(vertexCount);
+        std::vector<Edge> upEdges(upCount);
+        std::vector<Edge> downEdges(downCount);
+
+        ifs.read(reinterpret_cast<char*>(rank.data()), sizeof(int) * rank.size());
+        ifs.read(reinterpret_cast<char*>(upEdges.data()), sizeof(Edge) * upEdges.size());
+        ifs.read(reinterpret_cast<char*>(downEdges.data()), sizeof(Edge) * downEdges.size());
+
+        if (false == ifs.good())
+            return false;
+
+        // 손상된 파일이라면 CSRGraph를 만들 때 범위를 벗어난 곳에 접근하게 된다.
+        auto isValidEdge = [vertexCount](const Edge& edge) {
+            return edge.from >= 0 && edge.from < vertexCount && edge.to >= 0 && edge.to < vertexCount;
+        };
+
+        if (false == std::all_of(upEdges.begin(), upEdges.end(), isValidEdge) || false == std::all_of(downEdges.begin(), downEdges.end(), isValidEdge))
+            return false;
+
+        *this = ContractionHierarchy{ std::move(rank), upEdges, downEdges, shortcutCount };
+
+        return true;
+    }
+
+public:
+    int    VertexCount() const   { return (int)_rank.size(); }
+    size_t ShortcutCount() const { return _shortcutCount; }
+
+    int Rank(int v) const { return _rank[v]; }
+
+    const CSRGraph<int>& Up() const   { return _up; }
+    const CSRGraph<int>& Down() const { return _down; }
+
+private:
+    static std::vector<Edge> collectEdges(const CSRGraph<int>& graph)
+    {
+        std::vector<Edge> edges;
+        edges.reserve(graph.EdgeCount());
+
+        graph.ForEachEdge([&](int from, int to, int weight) {
+            edges.push_back({ from, to, weight });
+        });
+
+        return edges;
+    }
+
+private:
+    std::vector<int> _rank;
+
+    CSRGraph<int> _up;
+    CSRGraph<int> _down;
+
+    size_t _shortcutCount = 0;
+};
+
+class ContractionHierarchyBuilder
+{
+    static constexpr int kWitnessSettleLimit = 64;
+
+    struct Arc
+    {
+        int to;
+        int weight;
+    };
+
+public:
+    explicit ContractionHierarchyBuilder(const CSRGraph<int>& graph)
+        : _out(graph.VertexCount()), _in(graph.VertexCount()),
+          _contracted(graph.VertexCount(), false), _deletedNeighbors(graph.VertexCount(), 0), _level(graph.VertexCount(), 0),
+          _witness{ graph.VertexCount() }
+    {
+        graph.ForEachEdge([&](int from, int to, int weight) {
+            // 자기 자신으로 향하는 간선은 최단 경로에 쓰이지 않는다.
+            if (from != to)
+            {
+                this->addArc(from, to, weight);
+            }
+        });
+    }
+
+public:
+    ContractionHierarchy Build()
+    {
+        int vertexCount = (int)_out.size();
+
+        std::vector<int> rank(vertexCount);
+
+        std::vector<ContractionHierarchy::Edge> upEdges;
+        std::vector<ContractionHierarchy::Edge> downEdges;
+
+        // 우선순위, 정점
+        std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<>> order;
+
+        for (int v = 0; v < vertexCount; v++)
+        {
+            order.push({ this->priority(v), v });
+        }
+
+        int nextRank = 0;
+
+        while (false == order.empty())
+        {
+            int v = order.top().second;
+            order.pop();
+
+            // 이웃이 축약되면서 우선순위가 바뀌었을 수 있으니 다시 계산한다.
+            // 다음 후보보다 나빠졌다면 다시 넣고 다음 후보를 본다(lazy update).
+            int newPriority = this->priority(v);
+
+            if (false == order.empty() && newPriority > order.top().first)
+            {
+                order.push({ newPriority, v });
+
+                continue;
+            }
+
+            rank[v] = nextRank++;
+
+            this->contract(v, upEdges, downEdges);
+        }
+
+        return ContractionHierarchy{ std::move(rank), upEdges, downEdges, _shortcutCount };
+    }
+
+private:
+    // 평행 간선은 가장 가벼운 것만 남긴다.
+    void addArc(int from, int to, int weight)
+    {
+        for (Arc& arc : _out[from])
+        {
+            if (arc.to != to)
+                continue;
+
+            if (weight < arc.weight)
+            {
+                arc.weight = weight;
+
+                for (Arc& inArc : _in[to])
+                {
+                    if (inArc.to == from)
+                    {
+                        inArc.weight = weight;
+                    }
+                }
+            }
+
+            return;
+        }
+
+        _out[from].push_back({ to, weight });
+        _in[to].push_back({ from, weight });
+    }
+
+    // v를 거치지 않고 source에서 출발하는 제한된 다익스트라
+    void witnessSearch(int source, int skip, int64_t maxDist)
+    {
+        _witness.Reset();
+        _witness.Relax(source, 0, 0);
+
+        int settled = 0;
+
+        while (false == _witness.Empty())
+        {
+            auto [hereDist, here] = _witness.Pop();
+
+            if (hereDist > maxDist || ++settled > kWitnessSettleLimit)
+                break;
+
+            for (const Arc& arc : _out[here])
+            {
+                if (true == _contracted[arc.to] || arc.to == skip)
+                    continue;
+
+                int64_t nextDist = hereDist + arc.weight;
+
+                _witness.Relax(arc.to, nextDist, nextDist);
+            }
+        }
+    }
+
+    // v를 축약했을 때 필요한 지름길 목록
+    void findShortcuts(int v, std::vector<ContractionHierarchy::Edge>& outShortcuts)
+    {
+        for (const Arc& inArc : _in[v])
+        {
+            int u = inArc.to;
+
+            if (true == _contracted[u])
+                continue;
+
+            // 무게가 0인 간선도 있기 때문에 -1을 "남아 있는 이웃이 없음"으로 사용한다.
+            int64_t maxDist = -1;
+
+            for (const Arc& outArc : _out[v])
+            {
+                if (false == _contracted[outArc.to] && outArc.to != u)
+                {
+                    maxDist = std::max(maxDist, (int64_t)inArc.weight + outArc.weight);
+                }
+            }
+
+            if (maxDist < 0)
+                continue;
+
+            this->witnessSearch(u, v, maxDist);
+
+            for (const Arc& outArc : _out[v])
+            {
+                int x = outArc.to;
+
+                if (true == _contracted[x] || x == u)
+                    continue;
+
+                int viaWeight = inArc.weight + outArc.weight;
+
+                // witness 경로가 없거나 더 길다면 지름길이 필요하다.
+                if (_witness.Dist(x) > viaWeight)
+                {
+                    outShortcuts.push_back({ u, x, viaWeight });
+                }
+            }
+        }
+    }
+
+    int priority(int v)
+    {
+        _shortcuts.clear();
+
+        this->findShortcuts(v, _shortcuts);
+
+        int removedEdges = 0;
+
+        for (const Arc& arc : _out[v])
+        {
+            removedEdges += (false == _contracted[arc.to]);
+        }
+
+        for (const Arc& arc : _in[v])
+        {
+            removedEdges += (false == _contracted[arc.to]);
+        }
+
+        return (int)_shortcuts.size() - removedEdges + _deletedNeighbors[v] + _level[v];
+    }
+
+    void contract(int v, std::vector<ContractionHierarchy::Edge>& upEdges, std::vector<ContractionHierarchy::Edge>& downEdges)
+    {
+        // 아직 남아 있는 이웃은 모두 v보다 rank가 높다.
+        for (const Arc& arc : _out[v])
+        {
+            if (false == _contracted[arc.to])
+            {
+                upEdges.push_back({ v, arc.to, arc.weight });
+
+                _deletedNeighbors[arc.to]++;
+                _level[arc.to] = std::max(_level[arc.to], _level[v] + 1);
+            }
+        }
+
+        for (const Arc& arc : _in[v])
+        {
+            if (false == _contracted[arc.to])
+            {
+                downEdges.push_back({ v, arc.to, arc.weight });
+
+                _deletedNeighbors[arc.to]++;
+                _level[arc.to] = std::max(_level[arc.to], _level[v] + 1);
+            }
+        }
+
+        _shortcuts.clear();
+
+        this->findShortcuts(v, _shortcuts);
+
+        _contracted[v] = true;
+
+        for (const ContractionHierarchy::Edge& shortcut : _shortcuts)
+        {
+            this->addArc(shortcut.from, shortcut.to, shortcut.weight);
+        }
+
+        _shortcutCount += _shortcuts.size();
+
+        // 축약한 정점의 간선은 더 이상 필요 없다(이웃 쪽에 남은 간선도 지워서 이후의 탐색을 가볍게 한다).
+        auto pointsToV = [v](const Arc& arc) { return arc.to == v; };
+
+        for (const Arc& arc : _out[v])
+        {
+            std::erase_if(_in[arc.to], pointsToV);
+        }
+
+        for (const Arc& arc : _in[v])
+        {
+            std::erase_if(_out[arc.to], pointsToV);
+        }
+
+        std::vector<Arc>{ }.swap(_out[v]);
+        std::vector<Arc>{ }.swap(_in[v]);
+    }
+
+private:
+    std::vector<std::vector<Arc>> _out;
+    std::vector<std::vector<Arc>> _in;
+
+    std::vector<bool> _contracted;
+    std::vector<int>  _deletedNeighbors;
+    std::vector<int>  _level;
+
+    SearchSpace _witness;
+
+    std::vector<ContractionHierarchy::Edge> _shortcuts;
+
+    size_t _shortcutCount = 0;
+};
+
+// 축약 계층 쿼리
+// : 양쪽 모두 rank가 높아지는 방향으로만 탐색하고 양쪽에서 도달한 정점 중 (dF + dB)가 가장 작은 값을 찾는다.
+//   한쪽 탐색의 최솟값이 mu 이상이 되면 그쪽은 더 볼 필요가 없다.
+//
+// stall-on-demand
+// : 위로만 올라가는 탐색은 v에 도달한 거리가 실제 최단 거리보다 길 수 있다(더 높은 정점을 거쳐 내려오는 경로가 짧은 경우).
+//   rank가 높은 이웃 u를 거쳐 v로 오는 거리(d(u) + w)가 d(v)보다 짧다면 v는 최단 경로 위에 있을 수 없으므로
+//   v의 간선은 확장하지 않는다. 정방향이라면 이웃 u는 Down(v), 역방향이라면 Up(v)에 들어 있다.
+class ContractionHierarchyQuery
+{
+public:
+    explicit ContractionHierarchyQuery(const ContractionHierarchy& ch)
+        : _ch{ ch }, _forward{ ch.VertexCount() }, _backward{ ch.VertexCount() }
+    { }
+
+public:
+    QueryResult Run(int source, int target)
+    {
+        QueryResult result;
+
+        _forward.Reset();
+        _backward.Reset();
+
+        _forward.Relax(source, 0, 0);
+        _backward.Relax(target, 0, 0);
+
+        int64_t mu = kUnreachable;
+
+        while (_forward.MinKey() < mu || _backward.MinKey() < mu)
+        {
+            if (_forward.MinKey() < mu)
+            {
+                this->step(_ch.Up(), _ch.Down(), _forward, _backward, mu, result);
+            }
+
+            if (_backward.MinKey() < mu)
+            {
+                this->step(_ch.Down(), _ch.Up(), _backward, _forward, mu, result);
+            }
+        }
+
+        result.distance = mu;
+
+        return result;
+    }
+
+private:
+    static void step(const CSRGraph<int>& graph, const CSRGraph<int>& opposite, SearchSpace& here, const SearchSpace& other, int64_t& mu, QueryResult& result)
+    {
+        auto [hereDist, hereVertex] = here.Pop();
+
+        result.settled++;
+
+        if (kUnreachable != other.Dist(hereVertex))
+        {
+            mu = std::min(mu, hereDist + other.Dist(hereVertex));
+        }
+
+        // stall-on-demand
+        for (size_t idx = opposite.Begin(hereVertex); idx < opposite.End(hereVertex); idx++)
+        {
+            int64_t higherDist = here.Dist(opposite.Target(idx));
+
+            if (kUnreachable != higherDist && higherDist + opposite.Weight(idx) < hereDist)
+                return;
+        }
+
+        for (size_t idx = graph.Begin(hereVertex); idx < graph.End(hereVertex); idx++)
+        {
+            int64_t nextDist = hereDist + graph.Weight(idx);
+
+            here.Relax(graph.Target(idx), nextDist, nextDist);
+        }
+    }
+
+private:
+    const ContractionHierarchy& _ch;
+
+    SearchSpace _forward;
+    SearchSpace _backward;
+};
@@ -0,0 +1,184 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include "../CSRGraph.h"
+#include "../GraphGenerator.h"
+#include "ShortestPathQuery.h"
+#include "ContractionHierarchy.h"
+
+// ContractionHierarchy.h의 전처리 시간, 파일 저장/불러오기, 쿼리 시간 측정
+//
+// 쿼리 결과는 양방향 다익스트라(ShortestPathQuery.h)와 비교해서 검증한다.
+// 무게가 0인 간선이 섞인 그래프도 따로 검증한다(지름길이 누락되면 거리가 달라짐).
+// 전처리는 한 번만 하면 되고 이후의 쿼리는 마이크로초 단위로 처리된다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int kWidth       = 300;
+constexpr int kMaxWeight   = 10;
+constexpr int kQueryCount  = 100'000;
+constexpr int kVerifyCount = 200;
+
+constexpr const char* kFilePath = "contraction_hierarchy.bin";
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// 무게가 0인 간선이 있는 그래프에서 CH와 양방향 다익스트라의 결과가 같은지 확인한다.
+bool VerifyZeroWeights()
+{
+    // a -> m -> c 경로가 모두 0인 경우 : 정점 번호를 바꿔 가며 모든 배치를 확인한다.
+    int labels[3] = { 0, 1, 2 };
+
+    do
+    {
+        int a = labels[0];
+        int m = labels[1];
+        int c = labels[2];
+
+        CSRGraph<int> graph{ 3, { { a, m, 0 }, { m, c, 0 } } };
+
+        ContractionHierarchy ch = ContractionHierarchyBuilder{ graph }.Build();
+
+        if (0 != ContractionHierarchyQuery{ ch }.Run(a, c).distance)
+        {
+            cout << "Mismatch! (zero-weight path " << a << " -> " << m << " -> " << c << ")\n";
+
+            return false;
+        }
+    } while (true == next_permutation(begin(labels), end(labels)));
+
+    // 무게가 [0, 3]인 격자 그래프
+    constexpr int kZeroWidth = 60;
+
+    vector<GraphEdge> edges = MakeGridGraph(kZeroWidth, kZeroWidth, 4, 3);
+
+    for (GraphEdge& edge : edges)
+    {
+        edge.weight--;
+    }
+
+    CSRGraph<int> graph{ kZeroWidth * kZeroWidth, edges };
+    CSRGraph<int> reverse = graph.Transpose();
+
+    ContractionHierarchy ch = ContractionHierarchyBuilder{ graph }.Build();
+
+    BidirectionalDijkstraQuery bidirectional{ graph, reverse };
+    ContractionHierarchyQuery chQuery{ ch };
+
+    mt19937 rng{ 11 };
+    uniform_int_distribution<int> vertexDist{ 0, graph.VertexCount() - 1 };
+
+    for (int i = 0; i < kVerifyCount; i++)
+    {
+        int source = vertexDist(rng);
+        int target = vertexDist(rng);
+
+        if (bidirectional.Run(source, target).distance != chQuery.Run(source, target).distance)
+        {
+            cout << "Mismatch! (zero-weight grid) " << source << " -> " << target << '\n';
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main()
+{
+    if (false == VerifyZeroWeights())
+        return 1;
+
+    CSRGraph<int> graph{ kWidth * kWidth, MakeGridGraph(kWidth, kWidth, kMaxWeight) };
+    CSRGraph<int> reverse = graph.Transpose();
+
+    ContractionHierarchy ch;
+
+    double buildTime = Measure([&] {
+        ch = ContractionHierarchyBuilder{ graph }.Build();
+    });
+
+    cout << "V : " << graph.VertexCount() << ", E : " << graph.EdgeCount() << '\n';
+    cout << "Preprocessing : " << buildTime << "s, shortcuts : " << ch.ShortcutCount() << '\n';
+
+    // 저장한 파일을 다시 불러와서 쿼리에 사용한다.
+    ContractionHierarchy loaded;
+
+    if (false == ch.Save(kFilePath) || false == loaded.Load(kFilePath))
+    {
+        cout << "Failed to save or load " << kFilePath << '\n';
+
+        return 1;
+    }
+
+    mt19937 rng{ 7 };
+    uniform_int_distribution<int> vertexDist{ 0, graph.VertexCount() - 1 };
+
+    vector<pair<int, int>> queries(kQueryCount);
+
+    for (auto& [source, target] : queries)
+    {
+        source = vertexDist(rng);
+        target = vertexDist(rng);
+    }
+
+    BidirectionalDijkstraQuery bidirectional{ graph, reverse };
+    ContractionHierarchyQuery chQuery{ loaded };
+
+    // 검증
+    int64_t bidirectionalSettled = 0;
+    int64_t chSettled = 0;
+
+    double bidirectionalTime = Measure([&] {
+        for (int i = 0; i < kVerifyCount; i++)
+        {
+            bidirectionalSettled += bidirectional.Run(queries[i].first, queries[i].second).settled;
+        }
+    });
+
+    for (int i = 0; i < kVerifyCount; i++)
+    {
+        auto [source, target] = queries[i];
+
+        if (bidirectional.Run(source, target).distance != chQuery.Run(source, target).distance)
+        {
+            cout << "Mismatch! " << source << " -> " << target << '\n';
+
+            return 1;
+        }
+    }
+
+    double chTime = Measure([&] {
+        for (auto [source, target] : queries)
+        {
+            chSettled += chQuery.Run(source, target).settled;
+        }
+    });
+
+    cout << "Bidirectional : " << bidirectionalTime / kVerifyCount * 1'000'000 << "us/query"
+         << ", settled/query : " << bidirectionalSettled / kVerifyCount << '\n';
+
+    cout << "CH            : " << chTime / kQueryCount * 1'000'000 << "us/query"
+         << ", settled/query : " << chSettled / kQueryCount << '\n';
+
+    return 0;
+}
@@ -0,0 +1,394 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <barrier>
+#include <limits>
+#include <algorithm>
+
+#include "../CSRGraph.h"
+#include "../GraphGenerator.h"
+#include "ShortestPathQuery.h"
+
+// 델타 스테핑(Delta-Stepping)
+// : 다익스트라를 병렬로 처리할 수 있게 변형한 단일 출발점 최단 경로 알고리즘
+//
+// 다익스트라는 비용이 가장 작은 정점을 하나씩 확정하기 때문에 본질적으로 순차적이다.
+// 델타 스테핑은 비용을 delta 폭의 버킷으로 나누고 같은 버킷에 있는 정점들을 한꺼번에 처리한다.
+// - bucket[i] : i * delta <= dist < (i + 1) * delta
+//
+// 간선은 가중치에 따라 둘로 나눈다.
+// - light 간선(w <= delta) : 같은 버킷으로 다시 들어올 수 있기 때문에 버킷이 빌 때까지 반복해서 완화한다.
+// - heavy 간선(w > delta)  : 무조건 다음 버킷 이후로 가기 때문에 버킷이 확정된 뒤에 한 번만 완화한다.
+//
+// delta가 작으면 다익스트라에 가까워지고(병렬성이 낮음) delta가 크면 벨만-포드에 가까워진다(불필요한 재완화가 많음).
+//
+// 병렬화 방식
+// : 스레드마다 버킷 안의 정점을 나눠서 처리하고 std::barrier로 단계를 맞춘다(latches_and_barriers.cpp 참고).
+//   거리 갱신은 compare_exchange 기반의 atomic min으로 처리하고
+//   갱신된 정점은 스레드마다 따로 가진 버킷에 넣어서 push할 때 경합이 생기지 않게 한다.
+//
+//   모든 스레드가 barrier에 도착하면 완료 함수(PhaseCompletion)가 한 번 호출되는데
+//   여기서 다음 단계에서 처리할 정점 목록(frontier)을 만든다.
+//   std::barrier의 완료 함수는 noexcept로 호출되어야 하기 때문에 함수 객체 형태로 작성했다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+class DeltaStepping
+{
+    enum class Phase
+    {
+        Light,
+        Heavy,
+        Done,
+    };
+
+    struct PhaseCompletion
+    {
+        DeltaStepping* self;
+
+        void operator()() noexcept
+        {
+            self->onPhaseCompleted();
+        }
+    };
+
+public:
+    DeltaStepping(const CSRGraph<int>& graph, int threadCount)
+        : _graph{ graph }, _threadCount{ threadCount },
+          _dist(graph.VertexCount()), _mark(graph.VertexCount(), 0), _localBuckets(threadCount)
+    { }
+
+public:
+    vector<int64_t> Run(int source, int delta)
+    {
+        _delta = delta;
+        _phaseCount = 0;
+
+        for (atomic<int64_t>& dist : _dist)
+        {
+            dist.store(kUnreachable, memory_order_relaxed);
+        }
+
+        for (vector<vector<int>>& buckets : _localBuckets)
+        {
+            buckets.clear();
+        }
+
+        _dist[source].store(0, memory_order_relaxed);
+
+        _phase   = Phase::Light;
+        _current = 0;
+
+        _frontier = { source };
+        _settled.clear();
+
+        {
+            barrier phaseBarrier{ _threadCount, PhaseCompletion{ this } };
+
+            vector<jthread> workers;
+
+            for (int tid = 0; tid < _threadCount; tid++)
+            {
+                workers.emplace_back([this, tid, &phaseBarrier] { this->worker(tid, phaseBarrier); });
+            }
+        }
+
+        vector<int64_t> ret(_dist.size());
+
+        for (size_t v = 0; v < _dist.size(); v++)
+        {
+            ret[v] = _dist[v].load(memory_order_relaxed);
+        }
+
+        return ret;
+    }
+
+    int PhaseCount() const { return _phaseCount; }
+
+public:
+    // 평균 차수가 d이고 가중치가 [1, C]에 고르게 퍼져 있다면 delta = C / d 정도가 적당하다고 알려져 있다.
+    static int EstimateDelta(const CSRGraph<int>& graph)
+    {
+        int maxWeight = 1;
+
+        graph.ForEachEdge([&](int, int, int weight) {
+            maxWeight = max(maxWeight, weight);
+        });
+
+        double avgDegree = (double)graph.EdgeCount() / max(1, graph.VertexCount());
+
+        return max(1, (int)(maxWeight / max(1.0, avgDegree)));
+    }
+
+    // delta 자동 조정
+    // : EstimateDelta()의 값을 기준으로 몇 가지 후보를 실제로 실행해 보고 가장 빠른 값을 고른다.
+    //   그래프마다 한 번만 하면 되기 때문에 같은 그래프에 쿼리를 반복할 때 사용한다.
+    int TuneDelta(int source)
+    {
+        int estimated = EstimateDelta(_graph);
+
+        int    bestDelta = estimated;
+        double bestTime  = numeric_limits<double>::max();
+
+        for (int scale : { 1, 2, 4, 8, 16 })
+        {
+            int delta = max(1, estimated * scale / 4);
+
+            auto startTime = MyClock::now();
+
+            this->Run(source, delta);
+
+            auto endTime = MyClock::now();
+
+            double elapsed = chrono::duration_cast<MySecond>(endTime - startTime).count();
+
+            if (elapsed < bestTime)
+            {
+                bestTime  = elapsed;
+                bestDelta = delta;
+            }
+        }
+
+        return bestDelta;
+    }
+
+private:
+    void worker(int tid, barrier<PhaseCompletion>& phaseBarrier)
+    {
+        while (Phase::Done != _phase)
+        {
+            // 이번 단계에서 처리할 정점 목록을 스레드 개수만큼 나눈다.
+            const vector<int>& items = (Phase::Light == _phase) ? _frontier : _settled;
+
+            size_t begin = items.size() * tid / _threadCount;
+            size_t end   = items.size() * (tid + 1) / _threadCount;
+
+            bool isLight = (Phase::Light == _phase);
+
+            for (size_t i = begin; i < end; i++)
+            {
+                int     here     = items[i];
+                int64_t hereDist = _dist[here].load(memory_order_relaxed);
+
+                for (size_t idx = _graph.Begin(here); idx < _graph.End(here); idx++)
+                {
+                    int weight = _graph.Weight(idx);
+
+                    if ((weight <= _delta) == isLight)
+                    {
+                        this->relax(tid, _graph.Target(idx), hereDist + weight);
+                    }
+                }
+            }
+
+            // 모든 스레드가 도착하면 onPhaseCompleted()가 호출된 다음 풀려난다.
+            phaseBarrier.arrive_and_wait();
+        }
+    }
+
+    // atomic min(compare_exchange.cpp 참고)
+    void relax(int tid, int to, int64_t newDist)
+    {
+        int64_t oldDist = _dist[to].load(memory_order_relaxed);
+
+        while (newDist < oldDist)
+        {
+            if (true == _dist[to].compare_exchange_weak(oldDist, newDist, memory_order_relaxed))
+            {
+                size_t bucket = (size_t)(newDist / _delta);
+
+                vector<vector<int>>& buckets = _localBuckets[tid];
+
+                if (bucket >= buckets.size())
+                {
+                    buckets.resize(bucket + 1);
+                }
+
+                buckets[bucket].push_back(to);
+
+                break;
+            }
+        }
+    }
+
+    // barrier의 완료 함수(한 스레드에서만 실행됨)
+    void onPhaseCompleted()
+    {
+        _phaseCount++;
+
+        if (Phase::Light == _phase)
+        {
+            // 이번에 처리한 정점은 heavy 간선을 완화할 대상이다.
+            _settled.insert(_settled.end(), _frontier.begin(), _frontier.end());
+
+            // light 간선으로 같은 버킷에 다시 들어온 정점이 있다면 한 번 더 처리한다.
+            this->gatherBucket(_current);
+
+            if (false == _frontier.empty())
+                return;
+
+            // 버킷이 확정되었으니 heavy 간선을 처리한다(중복 제거).
+            _stamp++;
+
+            auto last = remove_if(_settled.begin(), _settled.end(), [this](int v) {
+                return _mark[v] == _stamp || (_mark[v] = _stamp, false);
+            });
+
+            _settled.erase(last, _settled.end());
+
+            _phase = Phase::Heavy;
+
+            return;
+        }
+
+        // heavy 단계가 끝나면 비어 있지 않은 다음 버킷을 찾는다.
+        _settled.clear();
+
+        size_t bucketCount = 0;
+
+        for (const vector<vector<int>>& buckets : _localBuckets)
+        {
+            bucketCount = max(bucketCount, buckets.size());
+        }
+
+        for (size_t bucket = _current + 1; bucket < bucketCount; bucket++)
+        {
+            this->gatherBucket(bucket);
+
+            if (false == _frontier.empty())
+            {
+                _current = bucket;
+                _phase   = Phase::Light;
+
+                return;
+            }
+        }
+
+        _phase = Phase::Done;
+    }
+
+    // 스레드마다 가진 bucket 목록을 합쳐서 frontier를 만든다.
+    // 이후에 더 작은 버킷으로 옮겨간 정점(stale)과 중복된 정점은 제외한다.
+    void gatherBucket(size_t bucket)
+    {
+        _frontier.clear();
+        _stamp++;
+
+        for (vector<vector<int>>& buckets : _localBuckets)
+        {
+            if (bucket >= buckets.size())
+                continue;
+
+            for (int v : buckets[bucket])
+            {
+                if ((size_t)(_dist[v].load(memory_order_relaxed) / _delta) != bucket || _mark[v] == _stamp)
+                    continue;
+
+                _mark[v] = _stamp;
+                _frontier.push_back(v);
+            }
+
+            buckets[bucket].clear();
+        }
+    }
+
+private:
+    const CSRGraph<int>& _graph;
+
+    int _threadCount;
+    int _delta = 1;
+
+    vector<atomic<int64_t>> _dist;
+
+    // 중복 제거용(완료 함수에서만 사용하기 때문에 atomic일 필요 없음)
+    vector<uint32_t> _mark;
+    uint32_t _stamp = 0;
+
+    vector<vector<vector<int>>> _localBuckets; // [스레드][버킷]
+
+    Phase  _phase   = Phase::Done;
+    size_t _current = 0;
+
+    vector<int> _frontier; // light 단계에서 처리할 정점
+    vector<int> _settled;  // heavy 단계에서 처리할 정점
+
+    int _phaseCount = 0;
+};
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+int main()
+{
+    constexpr int    kVertexCount = 2'000'000;
+    constexpr size_t kEdgeCount   = 16'000'000;
+    constexpr int    kMaxWeight   = 1'000;
+
+    CSRGraph<int> graph{ kVertexCount, MakeRandomGraph(kVertexCount, kEdgeCount, kMaxWeight) };
+
+    cout << "V : " << graph.VertexCount() << ", E : " << graph.EdgeCount() << '\n';
+
+    vector<int64_t> expected;
+
+    double dijkstraTime = Measure([&] { expected = DijkstraAll(graph, 0); });
+
+    cout << "Dijkstra(sequential) : " << dijkstraTime << "s\n";
+
+    int maxThreads = max(1u, thread::hardware_concurrency());
+
+    int delta = 0;
+
+    double tuneTime = Measure([&] { delta = DeltaStepping{ graph, maxThreads }.TuneDelta(0); });
+
+    cout << "Estimated delta : " << DeltaStepping::EstimateDelta(graph)
+         << ", tuned delta : " << delta << " (" << tuneTime << "s)\n\n";
+
+    vector<int> threadCounts;
+
+    for (int threads = 1; threads < maxThreads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+
+    threadCounts.push_back(maxThreads);
+
+    double baseTime = 0.0;
+
+    for (int threads : threadCounts)
+    {
+        DeltaStepping deltaStepping{ graph, threads };
+
+        vector<int64_t> dist;
+
+        double elapsed = Measure([&] { dist = deltaStepping.Run(0, delta); });
+
+        if (1 == threads)
+        {
+            baseTime = elapsed;
+        }
+
+        cout << "Threads : " << threads << ", " << elapsed << "s"
+             << ", speedup : " << baseTime / elapsed
+             << ", phases : " << deltaStepping.PhaseCount()
+             << (dist == expected ? "" : " (Mismatch!)") << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <queue>
+#include <limits>
+
+#include "../CSRGraph.h"
+#include "../GraphGenerator.h"
+#include "../IndexedHeap.h"
+
+// 인덱스 힙(IndexedHeap.h)을 사용한 다익스트라
+//
+// Dijkstra.cpp의 구현은 다음과 같은 특징이 있다.
+// - 인접 노드를 확인할 때마다 비용이 줄지 않아도 priority_queue에 push함.
+// - 같은 정점이 여러 번 들어가기 때문에 꺼낼 때 visited로 걸러야 함(lazy deletion).
+// - 최소 힙을 흉내내기 위해 비용을 음수로 바꿔서 넣음.
+//
+// 이렇게 하면 힙의 크기가 최대 E까지 커지고 pop 횟수도 E에 비례한다.
+//
+// 인덱스 힙을 사용하면 정점마다 힙 안에 최대 하나의 원소만 존재하게 된다.
+// 비용이 줄었을 때만 PushOrDecrease()를 호출하고 이미 들어 있다면 DecreaseKey()로 위치만 조정한다.
+// - 힙의 크기는 최대 V
+// - pop 횟수는 정확히 도달 가능한 정점의 수
+// - 꺼낸 정점은 항상 확정된 정점이기 때문에 visited 검사가 필요 없음
+//
+// 간선이 많은 밀집 그래프일수록 차이가 크게 벌어진다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int INF = numeric_limits<int>::max();
+
+struct DijkstraStats
+{
+    int64_t pushes       = 0;
+    int64_t pops         = 0;
+    int64_t decreaseKeys = 0;
+    int64_t peakSize     = 0;
+};
+
+// Dijkstra.cpp와 같은 방식(비용이 줄어들지 않아도 push, 음수로 최소 힙 흉내)
+vector<int> DijkstraLazy(const CSRGraph<int>& graph, int start, DijkstraStats& stats)
+{
+    vector<int>  cost(graph.VertexCount(), INF);
+    vector<bool> visited(graph.VertexCount(), false);
+
+    // 비용, 노드
+    priority_queue<pair<int, int>> pq;
+
+    cost[start] = 0;
+    pq.push({ 0, start });
+
+    stats.pushes++;
+
+    while (pq.size() > 0)
+    {
+        auto pair = pq.top();
+        pq.pop();
+
+        stats.pops++;
+
+        if (true == visited[pair.second])
+            continue;
+
+        visited[pair.second] = true;
+
+        for (size_t idx = graph.Begin(pair.second); idx < graph.End(pair.second); idx++)
+        {
+            int to = graph.Target(idx);
+
+            if (true == visited[to])
+                continue;
+
+            cost[to] = min(cost[to], cost[pair.second] + graph.Weight(idx));
+
+            pq.push({ -cost[to], to });
+
+            stats.pushes++;
+            stats.peakSize = max(stats.peakSize, (int64_t)pq.size());
+        }
+    }
+
+    return cost;
+}
+
+// 인덱스 힙 + DecreaseKey 방식
+template <int Arity>
+vector<int> DijkstraIndexed(const CSRGraph<int>& graph, int start, DijkstraStats& stats)
+{
+    vector<int> cost(graph.VertexCount(), INF);
+
+    IndexedHeap<int, Arity> heap{ graph.VertexCount() };
+
+    cost[start] = 0;
+    heap.Push(start, 0);
+
+    stats.pushes++;
+
+    while (false == heap.Empty())
+    {
+        // 꺼낸 정점은 확정된 정점이다.
+        auto [hereCost, here] = heap.Pop();
+
+        stats.pops++;
+
+        for (size_t idx = graph.Begin(here); idx < graph.End(here); idx++)
+        {
+            int to       = graph.Target(idx);
+            int nextCost = hereCost + graph.Weight(idx);
+
+            // 비용이 줄어들 때만 힙을 건드린다.
+            if (nextCost >= cost[to])
+                continue;
+
+            if (true == heap.Contains(to))
+            {
+                stats.decreaseKeys++;
+            }
+            else
+            {
+                stats.pushes++;
+            }
+
+            cost[to] = nextCost;
+            heap.PushOrDecrease(to, nextCost);
+
+            stats.peakSize = max(stats.peakSize, (int64_t)heap.Count());
+        }
+    }
+
+    return cost;
+}
+
+template <typename Func>
+void Run(const char* name, const CSRGraph<int>& graph, vector<int>& outCost, Func&& func)
+{
+    DijkstraStats stats;
+
+    auto startTime = MyClock::now();
+
+    outCost = func(graph, 0, stats);
+
+    auto endTime = MyClock::now();
+
+    cout << name << " : " << chrono::duration_cast<MySecond>(endTime - startTime).count() << "s"
+         << ", pushes : " << stats.pushes
+         << ", pops : " << stats.pops
+         << ", decreaseKeys : " << stats.decreaseKeys
+         << ", peak heap size : " << stats.peakSize << '\n';
+}
+
+void Benchmark(int vertexCount, size_t edgeCount)
+{
+    CSRGraph<int> graph{ vertexCount, MakeRandomGraph(vertexCount, edgeCount, 1'000) };
+
+    cout << "V : " << vertexCount << ", E : " << edgeCount << '\n';
+
+    vector<int> lazyCost;
+    vector<int> binaryCost;
+    vector<int> quaternaryCost;
+
+    Run("Lazy(priority_queue)", graph, lazyCost, DijkstraLazy);
+    Run("Indexed(2-ary)      ", graph, binaryCost, DijkstraIndexed<2>);
+    Run("Indexed(4-ary)      ", graph, quaternaryCost, DijkstraIndexed<4>);
+
+    if (lazyCost != binaryCost || lazyCost != quaternaryCost)
+    {
+        cout << "Mismatch!\n";
+    }
+
+    cout << '\n';
+}
+
+int main()
+{
+    // 희소 그래프
+    Benchmark(1'000'000, 4'000'000);
+
+    // 밀집 그래프
+    Benchmark(20'000, 8'000'000);
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <queue>
+#include <limits>
+
+#include "../CSRGraph.h"
+#include "../GraphGenerator.h"
+#include "../MonotoneQueue.h"
+
+// 정수 가중치 전용 다익스트라(MonotoneQueue.h)
+//
+// Dijkstra.cpp의 가중치는 모두 음이 아닌 작은 정수이다.
+// 이런 경우 비교 기반 힙 대신 단조 우선순위 큐를 사용할 수 있다.
+// - 래딕스 힙 : 가중치의 범위에 상관없이 사용 가능
+// - 다이얼 버킷 큐 : 가중치의 최댓값이 작을 때 사용(버킷 개수 = 최대 가중치 + 1)
+//
+// 사용할 큐는 QUEUE_MODE로 컴파일 타임에 선택한다.
+// 0 : std::priority_queue
+// 1 : RadixHeap
+// 2 : BucketQueue
+//
+// main()의 벤치마크는 QUEUE_MODE와 상관없이 세 가지 큐를 모두 측정하여 초당 pop 횟수를 비교한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+#define QUEUE_MODE 1
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr uint32_t INF = numeric_limits<uint32_t>::max();
+
+// std::priority_queue를 MonotoneQueue.h와 같은 인터페이스로 감싼 것
+class BinaryHeapQueue
+{
+public:
+    explicit BinaryHeapQueue(uint32_t /* maxWeight */)
+    { }
+
+public:
+    void Push(uint32_t key, int id) { _pq.push({ key, id }); }
+
+    pair<uint32_t, int> Pop()
+    {
+        pair<uint32_t, int> top = _pq.top();
+        _pq.pop();
+
+        return top;
+    }
+
+    bool Empty() const { return _pq.empty(); }
+
+private:
+    priority_queue<pair<uint32_t, int>, vector<pair<uint32_t, int>>, greater<>> _pq;
+};
+
+// RadixHeap은 최대 가중치를 필요로 하지 않기 때문에 생성자의 형태만 맞춰준다.
+class RadixHeapQueue : public RadixHeap
+{
+public:
+    explicit RadixHeapQueue(uint32_t /* maxWeight */)
+    { }
+};
+
+#if QUEUE_MODE == 0
+using DijkstraQueue = BinaryHeapQueue;
+#elif QUEUE_MODE == 1
+using DijkstraQueue = RadixHeapQueue;
+#else
+using DijkstraQueue = BucketQueue;
+#endif
+
+template <typename Queue = DijkstraQueue>
+vector<uint32_t> Dijkstra(const CSRGraph<int>& graph, int start, uint32_t maxWeight, int64_t* outPops = nullptr)
+{
+    vector<uint32_t> cost(graph.VertexCount(), INF);
+
+    Queue queue{ maxWeight };
+
+    int64_t pops = 0;
+
+    cost[start] = 0;
+    queue.Push(0, start);
+
+    while (false == queue.Empty())
+    {
+        auto [hereCost, here] = queue.Pop();
+
+        pops++;
+
+        // 이미 더 저렴한 비용으로 확정된 정점
+        if (hereCost > cost[here])
+            continue;
+
+        for (size_t idx = graph.Begin(here); idx < graph.End(here); idx++)
+        {
+            int      to       = graph.Target(idx);
+            uint32_t nextCost = hereCost + graph.Weight(idx);
+
+            if (nextCost < cost[to])
+            {
+                cost[to] = nextCost;
+                queue.Push(nextCost, to);
+            }
+        }
+    }
+
+    if (nullptr != outPops)
+    {
+        *outPops = pops;
+    }
+
+    return cost;
+}
+
+template <typename Queue>
+vector<uint32_t> Run(const char* name, const CSRGraph<int>& graph, uint32_t maxWeight)
+{
+    int64_t pops = 0;
+
+    auto startTime = MyClock::now();
+
+    vector<uint32_t> cost = Dijkstra<Queue>(graph, 0, maxWeight, &pops);
+
+    auto endTime = MyClock::now();
+
+    double elapsed = chrono::duration_cast<MySecond>(endTime - startTime).count();
+
+    cout << name << " : " << elapsed << "s, pops : " << pops << ", pops/s : " << pops / elapsed << '\n';
+
+    return cost;
+}
+
+void Benchmark(const char* title, const CSRGraph<int>& graph, uint32_t maxWeight)
+{
+    cout << title << " (V : " << graph.VertexCount() << ", E : " << graph.EdgeCount() << ", max weight : " << maxWeight << ")\n";
+
+    vector<uint32_t> heapCost   = Run<BinaryHeapQueue>("priority_queue", graph, maxWeight);
+    vector<uint32_t> radixCost  = Run<RadixHeapQueue>("RadixHeap     ", graph, maxWeight);
+    vector<uint32_t> bucketCost = Run<BucketQueue>("BucketQueue   ", graph, maxWeight);
+
+    if (heapCost != radixCost || heapCost != bucketCost)
+    {
+        cout << "Mismatch!\n";
+    }
+
+    cout << '\n';
+}
+
+int main()
+{
+    constexpr int kMaxWeight = 100;
+
+    {
+        constexpr int kWidth = 2'000;
+
+        CSRGraph<int> graph{ kWidth * kWidth, MakeGridGraph(kWidth, kWidth, kMaxWeight) };
+
+        Benchmark("Grid", graph, kMaxWeight);
+    }
+
+    {
+        constexpr int kVertexCount = 2'000'000;
+
+        CSRGraph<int> graph{ kVertexCount, MakePowerLawGraph(kVertexCount, kVertexCount * 8ull, kMaxWeight) };
+
+        Benchmark("Power-law", graph, kMaxWeight);
+    }
+
+    return 0;
+}
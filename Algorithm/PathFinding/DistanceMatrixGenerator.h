@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+
+#include "BlockedFloydWarshall.h"
+
+// 플로이드-워셜 벤치마크용 거리 행렬 생성 함수(GraphGenerator.h의 DistanceMatrix 버전)
+// 같은 시드를 넣으면 항상 같은 행렬이 나온다.
+
+// 정점마다 평균 edgesPerVertex개의 간선을 가진 랜덤 그래프
+inline DistanceMatrix MakeRandomDistanceMatrix(int n, int edgesPerVertex = 8, int maxWeight = 1'000, uint32_t seed = 1)
+{
+    std::mt19937 rng{ seed };
+    std::uniform_int_distribution<int> vertexDist{ 0, n - 1 };
+    std::uniform_int_distribution<int> weightDist{ 1, maxWeight };
+
+    DistanceMatrix dist{ n };
+
+    for (int i = 0; i < n * edgesPerVertex; i++)
+    {
+        dist.AddEdge(vertexDist(rng), vertexDist(rng), weightDist(rng));
+    }
+
+    return dist;
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#include "../ThreadPool.h"
+#include "BlockedFloydWarshall.h"
+
+// 모든 쌍 최단 거리의 점진적 갱신(간선 추가, 가중치 감소)
+//
+// 이미 플로이드 워셜로 구한 거리 행렬이 있을 때 간선 (u -> v, w)가 추가되거나 가중치가 w로 줄었다면
+// 새로 생길 수 있는 최단 경로는 모두 이 간선을 한 번 지나는 경로이다.
+//
+//   dist[i][j] = min(dist[i][j], dist[i][u] + w + dist[v][j])
+//
+// 따라서 O(V^3)으로 다시 계산할 필요 없이 O(V^2)에 갱신할 수 있다.
+// 각 행 i는 dist[i][u]와 v 행만 읽기 때문에 행끼리 독립적이고 BlockedFloydWarshall.h의 MinPlusRow()를 그대로 쓸 수 있다.
+//
+// 주의할 점
+// - 가중치가 늘어나거나 간선이 삭제되는 경우는 이 방식으로 처리할 수 없다(다시 계산해야 함).
+// - w + dist[v][u] < 0이라면 음의 사이클이 생기는 것이므로 갱신하지 않고 false를 반환한다.
+// - 음의 사이클이 없다면 dist[i][u]와 v 행은 이번 갱신으로 바뀌지 않는다.
+//
+// 여러 개를 한꺼번에 적용할 때는 갱신 횟수가 많아지면 (갱신 개수 * V^2)이 V^3보다 커진다.
+// 이 경우에는 간선만 반영하고 플로이드 워셜을 다시 돌리는 것이 더 빠르다.
+
+struct EdgeUpdate
+{
+    int     from;
+    int     to;
+    int32_t weight;
+};
+
+// next는 NextHopMatrix의 시작 주소(nullptr이면 경로를 기록하지 않음)
+template <typename Index = void>
+inline bool InsertEdge(DistanceMatrix& dist, const EdgeUpdate& update, ThreadPool* pool = nullptr, Index* next = nullptr)
+{
+    int u = update.from;
+    int v = update.to;
+
+    // 기존 경로보다 길다면 아무것도 바뀌지 않는다.
+    if (update.weight >= dist.At(u, v))
+        return true;
+
+    // 음의 사이클
+    if (kDistInf != dist.At(v, u) && update.weight + dist.At(v, u) < 0)
+        return false;
+
+    const int32_t* rowV = dist.Row(v);
+
+    auto updateRow = [&](size_t idx) {
+        int i = (int)idx;
+
+        int32_t iu = dist.At(i, u);
+
+        // v 행은 다른 행의 계산에 쓰이기 때문에 건드리지 않는다(음의 사이클이 없다면 바뀌지도 않음).
+        if (i == v || iu >= kDistInf)
+            return;
+
+        int32_t a = std::min(iu + update.weight, kDistInf);
+
+        if constexpr (std::is_void_v<Index>)
+        {
+            MinPlusRow(dist.Row(i), rowV, a, dist.Stride());
+        }
+        else
+        {
+            // i -> ... -> u -> v -> ... -> j 경로에서 i 다음 정점(i가 u라면 바로 v)
+            int32_t hop = (i == u) ? v : (int32_t)next[(size_t)i * dist.Stride() + u];
+
+            MinPlusRow(dist.Row(i), rowV, a, dist.Stride(), next + (size_t)i * dist.Stride(), hop);
+        }
+    };
+
+    if (nullptr != pool)
+    {
+        pool->ParallelFor(dist.Size(), updateRow);
+    }
+    else
+    {
+        for (int i = 0; i < dist.Size(); i++)
+        {
+            updateRow(i);
+        }
+    }
+
+    return true;
+}
+
+// 여러 개의 갱신을 한꺼번에 적용하고 음의 사이클 때문에 거부된 개수를 반환한다.
+//
+// recomputeThreshold : 갱신 개수가 이 값 이상이면 간선만 반영하고 플로이드 워셜을 다시 돌린다.
+//                      0이면 V를 사용한다(갱신 하나가 V^2, 재계산이 V^3이기 때문에 대략 V개에서 역전됨).
+//
+// (다시 계산하는 경우에는 음의 사이클을 만드는 간선을 걸러낼 수 없으니 음의 가중치가 없을 때만 쓰는 것이 좋다.)
+template <typename Index = void>
+inline size_t ApplyBatch(DistanceMatrix& dist, const std::vector<EdgeUpdate>& updates, ThreadPool& pool, size_t recomputeThreshold = 0, Index* next = nullptr)
+{
+    if (0 == recomputeThreshold)
+    {
+        recomputeThreshold = std::max<size_t>(1, dist.Size());
+    }
+
+    if (updates.size() >= recomputeThreshold)
+    {
+        for (const EdgeUpdate& update : updates)
+        {
+            if (update.weight < dist.At(update.from, update.to))
+            {
+                dist.At(update.from, update.to) = update.weight;
+
+                if constexpr (false == std::is_void_v<Index>)
+                {
+                    next[(size_t)update.from * dist.Stride() + update.to] = (Index)update.to;
+                }
+            }
+        }
+
+        FloydWarshallParallel(dist, pool, next);
+
+        return 0;
+    }
+
+    size_t rejected = 0;
+
+    for (const EdgeUpdate& update : updates)
+    {
+        if (false == InsertEdge(dist, update, &pool, next))
+        {
+            rejected++;
+        }
+    }
+
+    return rejected;
+}
@@ -0,0 +1,88 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <limits>
+
+#include "../ThreadPool.h"
+#include "BlockedFloydWarshall.h"
+#include "IncrementalAllPairs.h"
+
+// IncrementalAllPairs.h의 점진적 갱신과 플로이드 워셜 재계산 비교
+//
+// 갱신 개수(update rate)를 늘려가면서 다음 두 방식의 시간을 측정한다.
+// - Incremental : 갱신마다 O(V^2)
+// - Recompute   : 간선을 반영한 다음 FloydWarshallParallel()로 다시 계산, O(V^3)
+//
+// 두 방식의 결과가 같은지도 함께 확인한다.
+// 갱신 개수가 어느 정도일 때 두 방식의 시간이 역전되는지 보고 ApplyBatch()의 기준값을 정하면 된다.
+//
+// !! 최적화 기능과 AVX2 옵션(/arch:AVX2, -mavx2)을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int kSize = 1'024;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+int main()
+{
+    mt19937 rng{ 1 };
+    uniform_int_distribution<int> vertexDist{ 0, kSize - 1 };
+    uniform_int_distribution<int> weightDist{ 1, 1'000 };
+
+    DistanceMatrix base{ kSize };
+
+    for (int i = 0; i < kSize * 4; i++)
+    {
+        base.AddEdge(vertexDist(rng), vertexDist(rng), weightDist(rng));
+    }
+
+    ThreadPool pool;
+
+    FloydWarshallParallel(base, pool);
+
+    cout << "n : " << kSize << ", threads : " << pool.ThreadCount() << "\n\n";
+
+    for (size_t updateCount : { 1, 16, 256, 1'024, 4'096 })
+    {
+        vector<EdgeUpdate> updates(updateCount);
+
+        for (EdgeUpdate& update : updates)
+        {
+            update = { vertexDist(rng), vertexDist(rng), weightDist(rng) };
+        }
+
+        DistanceMatrix incremental = base;
+        DistanceMatrix recomputed  = base;
+
+        double incrementalTime = Measure([&] {
+            ApplyBatch(incremental, updates, pool, numeric_limits<size_t>::max());
+        });
+
+        double recomputeTime = Measure([&] {
+            ApplyBatch(recomputed, updates, pool, 1);
+        });
+
+        cout << "Updates : " << updateCount
+             << ", Incremental : " << incrementalTime << "s"
+             << ", Recompute : " << recomputeTime << "s"
+             << (incremental == recomputed ? "" : " (Mismatch!)") << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "../CSRGraph.h"
+#include "../IndexedHeap.h"
+#include "../ThreadPool.h"
+#include "BellmanFordSPFA.h"
+#include "ShortestPathQuery.h"
+
+// 존슨 알고리즘(Johnson's Algorithm)
+// : 음의 가중치가 있는 희소 그래프의 모든 쌍 최단 거리
+//
+// 플로이드 워셜은 간선 수와 상관없이 O(V^3)이다.
+// 간선이 적다면 모든 정점에서 다익스트라를 돌리는 것(O(V * E log V))이 더 빠르지만 다익스트라는 음의 가중치를 처리할 수 없다.
+//
+// 존슨 알고리즘은 가중치를 음수가 없도록 바꾼 다음 다익스트라를 V번 돌린다.
+// 1. 모든 정점으로 가중치 0인 간선을 가진 가상의 정점에서 벨만-포드를 돌려서 포텐셜 h(v)를 구한다.
+//    (BellmanFordSPFA()에 모든 정점을 출발점으로 넘기는 것과 같다.)
+// 2. 최단 거리의 성질에 의해 h(v) <= h(u) + w(u, v)이므로 w'(u, v) = w(u, v) + h(u) - h(v) >= 0이 된다.
+// 3. 경로 s -> ... -> t의 가중치 합은 w' 기준으로 (원래 가중치 합 + h(s) - h(t))이다.
+//    중간 정점의 포텐셜은 모두 상쇄되기 때문에 w'에서의 최단 경로는 원래 그래프에서도 최단 경로이다.
+//    dist(s, t) = dist'(s, t) - h(s) + h(t)
+//
+// 다익스트라는 출발점마다 독립적이기 때문에 ThreadPool로 나눠서 처리한다.
+// - 출발점 s의 결과는 out[s * V, (s + 1) * V) 구간에만 쓰기 때문에 동기화가 필요 없다.
+// - 결과 행을 그대로 다익스트라의 거리 배열로 사용하고 탐색이 끝나면 원래 가중치 기준으로 되돌린다.
+// - 힙은 출발점 묶음(chunk)마다 하나씩 만들어서 재사용한다.
+//
+// 가중치를 바꾼 그래프를 따로 만들지 않고 간선을 확인할 때 w'을 계산한다(그래프를 복사하는 메모리를 아끼기 위함).
+
+// out : V * V 크기의 행 우선(row-major) 버퍼, 도달할 수 없으면 kUnreachable
+// 음의 사이클이 있다면 false를 반환하며 negativeCycle이 nullptr이 아니면 사이클을 기록한다(out은 건드리지 않음).
+inline bool JohnsonAllPairs(const CSRGraph<int>& graph, int64_t* out, ThreadPool& pool, std::vector<int>* negativeCycle = nullptr)
+{
+    int vertexCount = graph.VertexCount();
+
+    std::vector<int> sources(vertexCount);
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        sources[v] = v;
+    }
+
+    BellmanFordResult potential = BellmanFordSPFA(graph, sources);
+
+    if (false == potential.negativeCycle.empty())
+    {
+        if (nullptr != negativeCycle)
+        {
+            *negativeCycle = std::move(potential.negativeCycle);
+        }
+
+        return false;
+    }
+
+    const std::vector<int64_t>& h = potential.dist;
+
+    // 스레드마다 여러 개의 묶음을 처리하게 해서 출발점마다 탐색 비용이 달라도 부하가 고르게 분산되게 한다.
+    size_t chunkCount = std::min<size_t>(vertexCount, (size_t)pool.ThreadCount() * 8);
+    size_t chunkSize  = (vertexCount + chunkCount - 1) / std::max<size_t>(1, chunkCount);
+
+    pool.ParallelFor(chunkCount, [&](size_t chunk) {
+        IndexedHeap<int64_t> heap{ vertexCount };
+
+        size_t first = chunk * chunkSize;
+        size_t last  = std::min<size_t>(first + chunkSize, vertexCount);
+
+        for (size_t source = first; source < last; source++)
+        {
+            int64_t* row = out + source * vertexCount;
+
+            std::fill(row, row + vertexCount, kUnreachable);
+
+            row[source] = 0;
+            heap.Push((int)source, 0);
+
+            while (false == heap.Empty())
+            {
+                auto [hereDist, here] = heap.Pop();
+
+                for (size_t idx = graph.Begin(here); idx < graph.End(here); idx++)
+                {
+                    int     to       = graph.Target(idx);
+                    int64_t nextDist = hereDist + graph.Weight(idx) + h[here] - h[to];
+
+                    if (nextDist < row[to])
+                    {
+                        row[to] = nextDist;
+                        heap.PushOrDecrease(to, nextDist);
+                    }
+                }
+            }
+
+            for (int to = 0; to < vertexCount; to++)
+            {
+                if (kUnreachable != row[to])
+                {
+                    row[to] += h[to] - h[source];
+                }
+            }
+        }
+    });
+
+    return true;
+}
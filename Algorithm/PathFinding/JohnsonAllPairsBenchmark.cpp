@@ -0,0 +1,216 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "../CSRGraph.h"
+#include "../GraphGenerator.h"
+#include "../ThreadPool.h"
+#include "BlockedFloydWarshall.h"
+#include "JohnsonAllPairs.h"
+
+// JohnsonAllPairs.h와 플로이드 워셜(BlockedFloydWarshall.h) 비교
+//
+// 음의 가중치가 있는 희소 그래프(정점마다 평균 4개의 간선)에서 모든 쌍 최단 거리를 구한다.
+// 간선 수가 적을수록 존슨 알고리즘이 유리하고 완전 그래프에 가까울수록 플로이드 워셜이 유리하다.
+// 음의 사이클이 없도록 포텐셜을 이용해서 가중치를 바꾼다(GraphGenerator.h의 MakeNegativeWeightGraph() 참고).
+//
+// 음의 사이클이 있는 그래프에서는 false를 반환하는지, 돌려준 사이클이 닫혀 있고 가중치 합이 음수인지,
+// 결과 버퍼를 건드리지 않았는지 검증한다(직접 넣은 사이클, 작은 랜덤 그래프).
+//
+// !! 최적화 기능과 AVX2 옵션(/arch:AVX2, -mavx2)을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// 추출한 사이클이 실제 간선으로 이어져 있는지 확인하고 가중치 합을 구한다.
+bool VerifyCycle(const CSRGraph<int>& graph, const vector<int>& cycle, int64_t* cost)
+{
+    *cost = 0;
+
+    for (size_t idx = 0; idx < cycle.size(); idx++)
+    {
+        int from = cycle[idx];
+        int to   = cycle[(idx + 1) % cycle.size()];
+
+        int64_t best = kBellmanFordInf;
+
+        for (size_t edge = graph.Begin(from); edge < graph.End(from); edge++)
+        {
+            if (to == graph.Target(edge))
+            {
+                best = min<int64_t>(best, graph.Weight(edge));
+            }
+        }
+
+        if (kBellmanFordInf == best)
+            return false;
+
+        *cost += best;
+    }
+
+    return true;
+}
+
+// 음의 사이클 판정을 모든 정점으로 가중치 0인 간선을 가진 가상의 정점에서 실행한 패스 방식과 비교한다.
+// 사이클이 있다면 false를 반환했는지, 사이클이 닫혀 있고 가중치 합이 음수인지, out을 건드리지 않았는지 확인한다.
+bool CheckNegativeCycle(int vertexCount, const vector<GraphEdge>& edges, ThreadPool& pool, bool* hasCycle)
+{
+    CSRGraph<int> graph{ vertexCount, edges };
+
+    vector<GraphEdge> withSource = edges;
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        withSource.push_back({ vertexCount, v, 0 });
+    }
+
+    BellmanFordResult passes = BellmanFordPasses(CSRGraph<int>{ vertexCount + 1, withSource }, vertexCount, true);
+
+    constexpr int64_t kUntouched = -1;
+
+    vector<int64_t> buffer((size_t)vertexCount * vertexCount, kUntouched);
+    vector<int>     cycle;
+
+    bool hasPaths = JohnsonAllPairs(graph, buffer.data(), pool, &cycle);
+
+    *hasCycle = (false == passes.negativeCycle.empty());
+
+    if (hasPaths == *hasCycle)
+        return false;
+
+    if (true == hasPaths)
+        return cycle.empty();
+
+    for (int64_t value : buffer)
+    {
+        if (kUntouched != value)
+            return false;
+    }
+
+    int64_t cost = 0;
+
+    return (false == cycle.empty()) && VerifyCycle(graph, cycle, &cost) && cost < 0;
+}
+
+// 작은 랜덤 그래프에서 음의 사이클 판정 검증
+void RunRandomNegativeCycles(int graphCount, ThreadPool& pool)
+{
+    // 포텐셜을 구할 때 부모를 따라가다가 출발점(-1)에 도착하는 그래프
+    vector<GraphEdge> known = {
+        { 0, 2, -1 }, { 3, 1, -2 }, { 2, 3, 7 }, { 2, 1, 0 }, { 2, 1, 10 }, { 0, 2, 13 },
+        { 1, 0, 6 }, { 0, 0, 1 }, { 1, 1, 1 }, { 1, 0, -1 }, { 2, 3, 5 }
+    };
+
+    bool hasCycle = false;
+    bool isValid  = CheckNegativeCycle(4, known, pool, &hasCycle) && hasCycle;
+
+    mt19937 rng{ 11 };
+    uniform_int_distribution<int> vertexCountDist{ 2, 7 };
+    uniform_int_distribution<int> edgeCountDist{ 0, 19 };
+    uniform_int_distribution<int> weightDist{ -6, 13 };
+
+    int cycles = 0;
+
+    for (int i = 0; i < graphCount && isValid; i++)
+    {
+        int vertexCount = vertexCountDist(rng);
+        int edgeCount   = edgeCountDist(rng);
+
+        uniform_int_distribution<int> vertexDist{ 0, vertexCount - 1 };
+
+        vector<GraphEdge> edges(edgeCount);
+
+        for (GraphEdge& edge : edges)
+        {
+            edge = { vertexDist(rng), vertexDist(rng), weightDist(rng) };
+        }
+
+        isValid = isValid && CheckNegativeCycle(vertexCount, edges, pool, &hasCycle);
+        cycles += hasCycle;
+    }
+
+    cout << "Random graphs : " << graphCount << ", negative cycles : " << cycles << (isValid ? "" : " (Invalid!)") << '\n';
+}
+
+int main()
+{
+    ThreadPool pool;
+
+    cout << "Threads : " << pool.ThreadCount() << "\n\n";
+
+    for (int vertexCount : { 1'024, 2'048, 4'096 })
+    {
+        vector<GraphEdge> edges = MakeNegativeWeightGraph(vertexCount, (size_t)vertexCount * 4);
+
+        CSRGraph<int> graph{ vertexCount, edges };
+
+        vector<int64_t> johnson((size_t)vertexCount * vertexCount);
+
+        bool hasPaths = true;
+
+        double johnsonTime = Measure([&] { hasPaths = JohnsonAllPairs(graph, johnson.data(), pool); });
+
+        DistanceMatrix dist{ vertexCount };
+
+        for (const GraphEdge& edge : edges)
+        {
+            dist.AddEdge(edge.from, edge.to, edge.weight);
+        }
+
+        double floydTime = Measure([&] { FloydWarshallParallel(dist, pool); });
+
+        bool isValid = hasPaths;
+
+        for (int from = 0; from < vertexCount && isValid; from++)
+        {
+            for (int to = 0; to < vertexCount; to++)
+            {
+                int64_t expected = (kDistInf == dist.At(from, to)) ? kUnreachable : dist.At(from, to);
+
+                if (expected != johnson[(size_t)from * vertexCount + to])
+                {
+                    isValid = false;
+                    break;
+                }
+            }
+        }
+
+        cout << "V : " << vertexCount << ", E : " << graph.EdgeCount()
+             << ", Johnson : " << johnsonTime << "s"
+             << ", Floyd-Warshall : " << floydTime << "s"
+             << (isValid ? "" : " (Mismatch!)") << '\n';
+    }
+
+    // 음의 사이클이 있으면 결과를 쓰지 않고 사이클을 돌려준다.
+    cout << "\nNegative cycle\n";
+
+    vector<GraphEdge> edges = MakeNegativeWeightGraph(1'000, 4'000);
+
+    edges.push_back({ 10, 20, -2'000 });
+    edges.push_back({ 20, 10, -2'000 });
+
+    bool hasCycle = false;
+    bool isValid  = CheckNegativeCycle(1'000, edges, pool, &hasCycle) && hasCycle;
+
+    cout << "Injected cycle : " << (isValid ? "detected" : "(Invalid!)") << '\n';
+
+    RunRandomNegativeCycles(100'000, pool);
+
+    return 0;
+}
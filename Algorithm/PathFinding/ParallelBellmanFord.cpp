@@ -0,0 +1,240 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+#include "../CSRGraph.h"
+#include "../GraphGenerator.h"
+#include "../ThreadPool.h"
+#include "BellmanFordSPFA.h"
+
+// 간선 병렬(Edge-parallel) 벨만-포드
+//
+// BellmanFord.cpp의 주석에 있는 간선 목록 방식은 패스마다 모든 간선을 독립적으로 확인하기 때문에 데이터 병렬 처리에 적합하다.
+// 간선 배열을 스레드 개수보다 조금 많은 구간(chunk)으로 나누고 ThreadPool::ParallelFor()로 나눠서 완화한다.
+//
+// - 여러 스레드가 같은 정점의 거리를 동시에 갱신할 수 있기 때문에 거리는 atomic<int64_t>로 두고
+//   compare_exchange 기반의 atomic min으로 갱신한다(compare_exchange.cpp, DeltaStepping.cpp 참고).
+// - 같은 패스 안에서 다른 스레드가 갱신한 값을 읽을 수도 있고 아닐 수도 있지만
+//   거리는 줄어들기만 하므로 순차 버전과 마찬가지로 (V - 1)번 안에 수렴한다(먼저 보이면 더 빨리 수렴할 뿐).
+// - 구간마다 갱신 여부를 따로 기록했다가 마지막에 한 번만 공유 플래그(changed)에 써서 캐시 라인 경합을 줄인다.
+//   패스가 끝났을 때 changed가 false라면 바로 종료한다.
+// - V번째 패스에서도 갱신이 일어난다면 음의 사이클이 있는 것이다.
+//
+// 패스 사이의 동기화는 ParallelFor()가 모든 작업이 끝날 때까지 반환하지 않는 것으로 충분하기 때문에
+// 패스 안에서는 memory_order_relaxed를 사용한다.
+//
+// 간선은 출발 정점 순서(CSR 순서)로 저장해서 dist[from]을 읽을 때 캐시를 잘 활용할 수 있게 한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+class ParallelBellmanFord
+{
+    struct Edge
+    {
+        int from;
+        int to;
+        int weight;
+    };
+
+public:
+    ParallelBellmanFord(const CSRGraph<int>& graph, ThreadPool& pool)
+        : _vertexCount{ graph.VertexCount() }, _pool{ pool }, _dist(graph.VertexCount())
+    {
+        _edges.reserve(graph.EdgeCount());
+
+        graph.ForEachEdge([&](int from, int to, int weight) {
+            _edges.push_back({ from, to, weight });
+        });
+
+        _chunkCount = min(max<size_t>(1, _edges.size()), (size_t)_pool.ThreadCount() * 4);
+        _chunkSize  = (_edges.size() + _chunkCount - 1) / _chunkCount;
+    }
+
+public:
+    // 음의 사이클이 있다면 false를 반환한다.
+    bool Run(int source)
+    {
+        for (atomic<int64_t>& dist : _dist)
+        {
+            dist.store(kBellmanFordInf, memory_order_relaxed);
+        }
+
+        _dist[source].store(0, memory_order_relaxed);
+
+        _passCount = 0;
+
+        for (int pass = 0; pass < _vertexCount; pass++)
+        {
+            _passCount++;
+
+            if (false == this->relaxAll())
+                return true;
+        }
+
+        // V번째 패스까지 갱신이 일어났다.
+        return false;
+    }
+
+    vector<int64_t> Dist() const
+    {
+        vector<int64_t> ret(_dist.size());
+
+        for (size_t v = 0; v < _dist.size(); v++)
+        {
+            ret[v] = _dist[v].load(memory_order_relaxed);
+        }
+
+        return ret;
+    }
+
+    int PassCount() const { return _passCount; }
+
+private:
+    // 한 번이라도 갱신했다면 true
+    bool relaxAll()
+    {
+        atomic<bool> changed = false;
+
+        _pool.ParallelFor(_chunkCount, [&](size_t chunk) {
+            size_t first = chunk * _chunkSize;
+            size_t last  = min(first + _chunkSize, _edges.size());
+
+            bool localChanged = false;
+
+            for (size_t idx = first; idx < last; idx++)
+            {
+                const Edge& edge = _edges[idx];
+
+                int64_t fromDist = _dist[edge.from].load(memory_order_relaxed);
+
+                if (kBellmanFordInf == fromDist)
+                    continue;
+
+                localChanged |= this->relax(edge.to, fromDist + edge.weight);
+            }
+
+            if (true == localChanged)
+            {
+                changed.store(true, memory_order_relaxed);
+            }
+        });
+
+        return changed.load(memory_order_relaxed);
+    }
+
+    // atomic min(compare_exchange.cpp 참고)
+    bool relax(int to, int64_t newDist)
+    {
+        int64_t oldDist = _dist[to].load(memory_order_relaxed);
+
+        while (newDist < oldDist)
+        {
+            if (true == _dist[to].compare_exchange_weak(oldDist, newDist, memory_order_relaxed))
+                return true;
+        }
+
+        return false;
+    }
+
+private:
+    int         _vertexCount;
+    ThreadPool& _pool;
+
+    vector<Edge> _edges;
+
+    size_t _chunkCount = 1;
+    size_t _chunkSize  = 0;
+
+    vector<atomic<int64_t>> _dist;
+
+    int _passCount = 0;
+};
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+int main()
+{
+    constexpr int    kVertexCount = 1'000'000;
+    constexpr size_t kEdgeCount   = 8'000'000;
+
+    CSRGraph<int> graph{ kVertexCount, MakeNegativeWeightGraph(kVertexCount, kEdgeCount) };
+
+    cout << "V : " << graph.VertexCount() << ", E : " << graph.EdgeCount() << '\n';
+
+    BellmanFordResult expected;
+
+    double sequentialTime = Measure([&] { expected = BellmanFordPasses(graph, 0, true); });
+
+    cout << "Sequential(early exit) : " << sequentialTime << "s, passes : " << expected.passes << "\n\n";
+
+    int maxThreads = max(1u, thread::hardware_concurrency());
+
+    vector<int> threadCounts;
+
+    for (int threads = 1; threads < maxThreads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+
+    threadCounts.push_back(maxThreads);
+
+    double baseTime = 0.0;
+
+    for (int threads : threadCounts)
+    {
+        ThreadPool pool{ threads };
+
+        ParallelBellmanFord bellmanFord{ graph, pool };
+
+        bool isValid = true;
+
+        double elapsed = Measure([&] { isValid = bellmanFord.Run(0); });
+
+        isValid = isValid && (bellmanFord.Dist() == expected.dist);
+
+        if (1 == threads)
+        {
+            baseTime = elapsed;
+        }
+
+        cout << "Threads : " << threads << ", " << elapsed << "s"
+             << ", speedup : " << baseTime / elapsed
+             << ", passes : " << bellmanFord.PassCount()
+             << (isValid ? "" : " (Mismatch!)") << '\n';
+    }
+
+    // 음의 사이클 검출
+    vector<GraphEdge> edges = MakeNegativeWeightGraph(10'000, 40'000);
+
+    edges.push_back({ 100, 200, -2'000 });
+    edges.push_back({ 200, 100, -2'000 });
+
+    ThreadPool pool{ maxThreads };
+
+    CSRGraph<int> cyclic{ 10'000, edges };
+
+    ParallelBellmanFord bellmanFord{ cyclic, pool };
+
+    cout << "\nNegative cycle detected : " << (bellmanFord.Run(0) ? "false" : "true") << ", passes : " << bellmanFord.PassCount() << '\n';
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#include "../ThreadPool.h"
+#include "BlockedFloydWarshall.h"
+#include "DistanceMatrixGenerator.h"
+
+// BlockedFloydWarshall.h의 멀티스레드 버전과 next-hop 행렬 측정
+//
+// 1. 스레드 개수에 따른 처리 시간(2, 3단계 타일을 ThreadPool로 분산)
+// 2. next-hop 행렬(uint16_t)을 같이 갱신할 때의 추가 비용
+// 3. 복원한 경로의 가중치 합이 거리 행렬의 값과 일치하는지 검증
+//
+// !! 최적화 기능과 AVX2 옵션(/arch:AVX2, -mavx2)을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int kSize = 2'048;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// 복원한 경로의 가중치를 원래 간선 정보로 다시 더해서 거리와 비교
+bool VerifyPaths(const DistanceMatrix& edges, const DistanceMatrix& dist, const NextHopMatrix<uint16_t>& next)
+{
+    mt19937 rng{ 3 };
+    uniform_int_distribution<int> vertexDist{ 0, dist.Size() - 1 };
+
+    for (int i = 0; i < 10'000; i++)
+    {
+        int from = vertexDist(rng);
+        int to   = vertexDist(rng);
+
+        vector<int> path = next.ReconstructPath(from, to);
+
+        if (true == path.empty())
+        {
+            if (kDistInf != dist.At(from, to))
+                return false;
+
+            continue;
+        }
+
+        int64_t cost = 0;
+
+        for (size_t idx = 1; idx < path.size(); idx++)
+        {
+            cost += edges.At(path[idx - 1], path[idx]);
+        }
+
+        if (cost != dist.At(from, to))
+            return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+#if defined(__AVX2__)
+    cout << "Kernel : AVX2\n";
+#else
+    cout << "Kernel : Scalar\n";
+#endif
+
+    const DistanceMatrix edges = MakeRandomDistanceMatrix(kSize);
+
+    DistanceMatrix expected = edges;
+
+    double serialTime = Measure([&] { FloydWarshallBlocked(expected); });
+
+    cout << "n : " << kSize << ", Serial : " << serialTime << "s\n\n";
+
+    int maxThreads = (int)max(1u, thread::hardware_concurrency());
+
+    vector<int> threadCounts;
+
+    for (int threads = 1; threads < maxThreads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts)
+    {
+        ThreadPool pool{ threads };
+
+        DistanceMatrix dist = edges;
+
+        double elapsed = Measure([&] { FloydWarshallParallel(dist, pool); });
+
+        DistanceMatrix distWithPath = edges;
+        NextHopMatrix<uint16_t> next{ edges };
+
+        double elapsedWithPath = Measure([&] { FloydWarshallParallel(distWithPath, next, pool); });
+
+        bool isValid = (dist == expected) && (distWithPath == expected) && VerifyPaths(edges, distWithPath, next);
+
+        cout << "Threads : " << threads
+             << ", Distance only : " << elapsed << "s (speedup : " << serialTime / elapsed << ")"
+             << ", With next-hop : " << elapsedWithPath << "s"
+             << (isValid ? "" : " (Mismatch!)") << '\n';
+    }
+
+    cout << "\nNext-hop matrix : " << (size_t)kSize * kSize * sizeof(uint16_t) / (1024 * 1024) << "MB (uint16_t)"
+         << ", " << (size_t)kSize * kSize * sizeof(int32_t) / (1024 * 1024) << "MB (int32_t)\n";
+
+    return 0;
+}
@@ -0,0 +1,409 @@
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "../CSRGraph.h"
+#include "../IndexedHeap.h"
+
+// 출발지 -> 도착지(Point-to-Point) 최단 거리 쿼리
+//
+// Dijkstra.cpp는 시작 정점에서 모든 정점까지의 거리를 구한다.
+// 하지만 도착 지점이 정해져 있다면 도착 지점을 꺼낸 순간 탐색을 멈춰도 된다(조기 종료).
+//
+// 조기 종료만으로는 도착 지점까지의 거리를 반지름으로 하는 원 안의 정점을 모두 확정(settle)하게 된다.
+// 확정하는 정점의 수를 줄이는 방법으로 다음 두 가지를 제공한다.
+//
+// 양방향 다익스트라(Bidirectional Dijkstra)
+// : 출발지에서 정방향으로, 도착지에서 역방향 그래프(Transpose)로 동시에 탐색한다.
+//   반지름이 r인 원 하나 대신 반지름이 r / 2인 원 두 개를 탐색하는 것과 비슷하다.
+//   두 탐색이 만나는 지점을 지나는 경로 중 가장 짧은 것을 mu에 기록하고
+//   (정방향 최솟값 + 역방향 최솟값 >= mu)가 되면 종료한다.
+//
+// A* 알고리즘
+// : Dijkstra.cpp에 적혀 있듯이 다익스트라는 휴리스틱이 0인 A* 알고리즘이다.
+//   힙의 키로 (지금까지의 비용 + 도착지까지의 추정 비용)을 사용하면 도착지 방향의 정점을 먼저 확정한다.
+//   휴리스틱이 실제 비용을 넘지 않고(admissible) 간선마다 h(u) <= w + h(v)를 만족하면(consistent)
+//   한 번 꺼낸 정점은 다시 갱신되지 않기 때문에 다익스트라와 같은 방식으로 구현할 수 있다.
+//
+// 휴리스틱은 int64_t operator()(int vertex, int target) 형태의 함수 객체로 전달한다.
+// - EuclideanHeuristic : 정점의 좌표가 있을 때(지도, 격자)
+// - LandmarkHeuristic  : 좌표가 없는 일반 그래프(ALT : A*, Landmarks, Triangle inequality)
+//
+// 모든 쿼리 클래스는 내부 버퍼를 재사용하기 때문에 쿼리마다 V 크기의 배열을 새로 할당하거나 초기화하지 않는다.
+// 대신 하나의 객체를 여러 스레드에서 동시에 사용하면 안 된다.
+
+constexpr int64_t kUnreachable = std::numeric_limits<int64_t>::max();
+
+struct QueryResult
+{
+    int64_t distance = kUnreachable;
+    int     settled  = 0; // 힙에서 꺼내서 확정한 정점의 수
+};
+
+// 시작 정점에서 모든 정점까지의 거리(전처리용)
+inline std::vector<int64_t> DijkstraAll(const CSRGraph<int>& graph, int start)
+{
+    std::vector<int64_t> dist(graph.VertexCount(), kUnreachable);
+
+    IndexedHeap<int64_t> heap{ graph.VertexCount() };
+
+    dist[start] = 0;
+    heap.Push(start, 0);
+
+    while (false == heap.Empty())
+    {
+        auto [hereDist, here] = heap.Pop();
+
+        for (size_t idx = graph.Begin(here); idx < graph.End(here); idx++)
+        {
+            int     to       = graph.Target(idx);
+            int64_t nextDist = hereDist + graph.Weight(idx);
+
+            if (nextDist < dist[to])
+            {
+                dist[to] = nextDist;
+                heap.PushOrDecrease(to, nextDist);
+            }
+        }
+    }
+
+    return dist;
+}
+
+// 한 방향 탐색의 상태(거리 테이블 + 힙)
+// 갱신한 정점을 기억해 두었다가 Reset()에서 그 정점만 되돌린다.
+class SearchSpace
+{
+public:
+    explicit SearchSpace(int vertexCount)
+        : _dist(vertexCount, kUnreachable), _heap(vertexCount)
+    { }
+
+public:
+    void Reset()
+    {
+        for (int v : _touched)
+        {
+            _dist[v] = kUnreachable;
+        }
+
+        _touched.clear();
+        _heap.Clear();
+    }
+
+    // 거리가 줄어들었을 때만 갱신한다(key는 힙에서 사용할 우선순위).
+    bool Relax(int v, int64_t dist, int64_t key)
+    {
+        if (dist >= _dist[v])
+            return false;
+
+        if (kUnreachable == _dist[v])
+        {
+            _touched.push_back(v);
+        }
+
+        _dist[v] = dist;
+        _heap.PushOrDecrease(v, key);
+
+        return true;
+    }
+
+    std::pair<int64_t, int> Pop() { return _heap.Pop(); }
+
+public:
+    int64_t Dist(int v) const { return _dist[v]; }
+
+    bool    Empty() const  { return _heap.Empty(); }
+    int     Count() const  { return _heap.Count(); }
+    int64_t MinKey() const { return _heap.Empty() ? kUnreachable : _heap.Top().first; }
+
+private:
+    std::vector<int64_t> _dist;
+    std::vector<int>     _touched;
+
+    IndexedHeap<int64_t> _heap;
+};
+
+// 조기 종료 다익스트라
+class DijkstraQuery
+{
+public:
+    explicit DijkstraQuery(const CSRGraph<int>& graph)
+        : _graph{ graph }, _space{ graph.VertexCount() }
+    { }
+
+public:
+    QueryResult Run(int source, int target)
+    {
+        QueryResult result;
+
+        _space.Reset();
+        _space.Relax(source, 0, 0);
+
+        while (false == _space.Empty())
+        {
+            auto [hereDist, here] = _space.Pop();
+
+            result.settled++;
+
+            // 도착지를 꺼냈다면 더 볼 필요가 없다.
+            if (here == target)
+            {
+                result.distance = hereDist;
+
+                break;
+            }
+
+            for (size_t idx = _graph.Begin(here); idx < _graph.End(here); idx++)
+            {
+                int64_t nextDist = hereDist + _graph.Weight(idx);
+
+                _space.Relax(_graph.Target(idx), nextDist, nextDist);
+            }
+        }
+
+        return result;
+    }
+
+private:
+    const CSRGraph<int>& _graph;
+
+    SearchSpace _space;
+};
+
+// 양방향 다익스트라
+class BidirectionalDijkstraQuery
+{
+public:
+    BidirectionalDijkstraQuery(const CSRGraph<int>& graph, const CSRGraph<int>& reverse)
+        : _graph{ graph }, _reverse{ reverse }, _forward{ graph.VertexCount() }, _backward{ graph.VertexCount() }
+    { }
+
+public:
+    QueryResult Run(int source, int target)
+    {
+        QueryResult result;
+
+        _forward.Reset();
+        _backward.Reset();
+
+        _forward.Relax(source, 0, 0);
+        _backward.Relax(target, 0, 0);
+
+        // 지금까지 발견한 가장 짧은 경로
+        int64_t mu = (source == target) ? 0 : kUnreachable;
+
+        while (false == _forward.Empty() && false == _backward.Empty())
+        {
+            // 양쪽의 최솟값을 더한 것보다 짧은 경로는 더 이상 나올 수 없다.
+            if (_forward.MinKey() + _backward.MinKey() >= mu)
+                break;
+
+            // 힙에 남은 정점이 적은 쪽을 확장한다.
+            bool isForward = _forward.Count() <= _backward.Count();
+
+            const CSRGraph<int>& graph = isForward ? _graph : _reverse;
+
+            SearchSpace& here  = isForward ? _forward : _backward;
+            SearchSpace& other = isForward ? _backward : _forward;
+
+            auto [hereDist, hereVertex] = here.Pop();
+
+            result.settled++;
+
+            for (size_t idx = graph.Begin(hereVertex); idx < graph.End(hereVertex); idx++)
+            {
+                int     to       = graph.Target(idx);
+                int64_t nextDist = hereDist + graph.Weight(idx);
+
+                here.Relax(to, nextDist, nextDist);
+
+                // 반대편 탐색이 이미 도달한 정점이라면 두 탐색을 잇는 경로가 생긴다.
+                if (kUnreachable != other.Dist(to))
+                {
+                    mu = std::min(mu, nextDist + other.Dist(to));
+                }
+            }
+        }
+
+        result.distance = mu;
+
+        return result;
+    }
+
+private:
+    const CSRGraph<int>& _graph;
+    const CSRGraph<int>& _reverse;
+
+    SearchSpace _forward;
+    SearchSpace _backward;
+};
+
+// A* 알고리즘
+template <typename Heuristic>
+class AStarQuery
+{
+public:
+    AStarQuery(const CSRGraph<int>& graph, Heuristic heuristic)
+        : _graph{ graph }, _heuristic{ std::move(heuristic) }, _space{ graph.VertexCount() }
+    { }
+
+public:
+    QueryResult Run(int source, int target)
+    {
+        QueryResult result;
+
+        _space.Reset();
+        _space.Relax(source, 0, _heuristic(source, target));
+
+        while (false == _space.Empty())
+        {
+            int here = _space.Pop().second;
+
+            result.settled++;
+
+            int64_t hereDist = _space.Dist(here);
+
+            if (here == target)
+            {
+                result.distance = hereDist;
+
+                break;
+            }
+
+            for (size_t idx = _graph.Begin(here); idx < _graph.End(here); idx++)
+            {
+                int     to       = _graph.Target(idx);
+                int64_t nextDist = hereDist + _graph.Weight(idx);
+
+                if (nextDist >= _space.Dist(to))
+                    continue;
+
+                // 키 = 지금까지의 비용 + 추정 비용
+                _space.Relax(to, nextDist, nextDist + _heuristic(to, target));
+            }
+        }
+
+        return result;
+    }
+
+private:
+    const CSRGraph<int>& _graph;
+
+    Heuristic   _heuristic;
+    SearchSpace _space;
+};
+
+// 유클리드 거리 휴리스틱
+// : 간선의 가중치가 (두 정점 사이의 직선 거리 * scale) 이상이어야 한다.
+//   내림(floor)을 하더라도 가중치가 정수이기 때문에 consistent 조건이 유지된다.
+struct EuclideanHeuristic
+{
+    const std::vector<std::pair<double, double>>* coords;
+
+    double scale = 1.0;
+
+    int64_t operator()(int vertex, int target) const
+    {
+        double dx = (*coords)[vertex].first  - (*coords)[target].first;
+        double dy = (*coords)[vertex].second - (*coords)[target].second;
+
+        return (int64_t)(std::sqrt(dx * dx + dy * dy) * scale);
+    }
+};
+
+// 랜드마크 휴리스틱(ALT)
+// : 몇 개의 랜드마크 L에서 모든 정점까지의 거리를 미리 구해두고 삼각 부등식으로 하한을 계산한다.
+//
+// d(v, t) >= d(L, t) - d(L, v)
+// d(v, t) >= d(v, L) - d(t, L)
+//
+// d(L, *)는 정방향 그래프, d(*, L)은 역방향 그래프에서 다익스트라를 돌려서 구한다.
+// 랜드마크는 이미 고른 랜드마크들로부터 가장 먼 정점을 하나씩 추가하는 방식으로 고른다(farthest selection).
+//
+// 메모리 : V * (랜드마크 개수) * 2 * sizeof(int64_t)
+class LandmarkHeuristic
+{
+public:
+    LandmarkHeuristic(const CSRGraph<int>& graph, const CSRGraph<int>& reverse, int landmarkCount)
+        : _landmarkCount{ landmarkCount }
+    {
+        int vertexCount = graph.VertexCount();
+
+        _fromLandmark.resize((size_t)vertexCount * landmarkCount);
+        _toLandmark.resize((size_t)vertexCount * landmarkCount);
+
+        // 정점 0에서 가장 먼 정점을 첫 번째 랜드마크로 사용한다.
+        std::vector<int64_t> minDist = DijkstraAll(graph, 0);
+
+        for (int l = 0; l < landmarkCount; l++)
+        {
+            int landmark = 0;
+
+            for (int v = 0; v < vertexCount; v++)
+            {
+                if (kUnreachable != minDist[v] && minDist[v] > minDist[landmark])
+                {
+                    landmark = v;
+                }
+            }
+
+            _landmarks.push_back(landmark);
+
+            std::vector<int64_t> from = DijkstraAll(graph, landmark);
+            std::vector<int64_t> to   = DijkstraAll(reverse, landmark);
+
+            for (int v = 0; v < vertexCount; v++)
+            {
+                // 정점 하나의 랜드마크 거리들이 붙어 있도록 [v * L + l] 형태로 저장한다.
+                _fromLandmark[(size_t)v * landmarkCount + l] = from[v];
+                _toLandmark[(size_t)v * landmarkCount + l]   = to[v];
+
+                minDist[v] = (0 == l) ? from[v] : std::min(minDist[v], from[v]);
+            }
+        }
+    }
+
+public:
+    int64_t operator()(int vertex, int target) const
+    {
+        const int64_t* fromV = &_fromLandmark[(size_t)vertex * _landmarkCount];
+        const int64_t* fromT = &_fromLandmark[(size_t)target * _landmarkCount];
+        const int64_t* toV   = &_toLandmark[(size_t)vertex * _landmarkCount];
+        const int64_t* toT   = &_toLandmark[(size_t)target * _landmarkCount];
+
+        int64_t ret = 0;
+
+        for (int l = 0; l < _landmarkCount; l++)
+        {
+            // 도달할 수 없는 랜드마크는 하한을 줄 수 없다.
+            if (kUnreachable != fromV[l] && kUnreachable != fromT[l])
+            {
+                ret = std::max(ret, fromT[l] - fromV[l]);
+            }
+
+            if (kUnreachable != toV[l] && kUnreachable != toT[l])
+            {
+                ret = std::max(ret, toV[l] - toT[l]);
+            }
+        }
+
+        return ret;
+    }
+
+public:
+    const std::vector<int>& Landmarks() const { return _landmarks; }
+
+private:
+    int _landmarkCount;
+
+    std::vector<int> _landmarks;
+
+    std::vector<int64_t> _fromLandmark; // d(L, v)
+    std::vector<int64_t> _toLandmark;   // d(v, L)
+};
@@ -0,0 +1,112 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "../CSRGraph.h"
+#include "../GraphGenerator.h"
+#include "ShortestPathQuery.h"
+
+// ShortestPathQuery.h에 작성한 출발지 -> 도착지 쿼리 비교
+//
+// 같은 쿼리 묶음을 각 방식으로 실행해서 쿼리 당 평균 시간과 확정(settle)한 정점의 수를 출력한다.
+// 확정한 정점의 수가 곧 탐색 공간의 크기이기 때문에 이 값이 얼마나 줄었는지를 보면 된다.
+//
+// 격자 그래프에서 이웃한 정점 사이의 직선 거리는 1이고 가중치는 1 이상이기 때문에
+// scale을 1로 지정하면 유클리드 휴리스틱이 admissible 조건을 만족한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int kWidth      = 1'000;
+constexpr int kMaxWeight  = 4;
+constexpr int kQueryCount = 100;
+constexpr int kLandmarks  = 8;
+
+template <typename Query>
+vector<int64_t> Run(const char* name, Query& query, const vector<pair<int, int>>& queries)
+{
+    vector<int64_t> distances;
+    distances.reserve(queries.size());
+
+    int64_t totalSettled = 0;
+
+    auto startTime = MyClock::now();
+
+    for (auto [source, target] : queries)
+    {
+        QueryResult result = query.Run(source, target);
+
+        distances.push_back(result.distance);
+        totalSettled += result.settled;
+    }
+
+    auto endTime = MyClock::now();
+
+    double elapsed = chrono::duration_cast<MySecond>(endTime - startTime).count();
+
+    cout << name << " : " << elapsed / queries.size() * 1'000'000 << "us/query"
+         << ", settled/query : " << totalSettled / (int64_t)queries.size() << '\n';
+
+    return distances;
+}
+
+int main()
+{
+    CSRGraph<int> graph{ kWidth * kWidth, MakeGridGraph(kWidth, kWidth, kMaxWeight) };
+    CSRGraph<int> reverse = graph.Transpose();
+
+    vector<pair<double, double>> coords(graph.VertexCount());
+
+    for (int v = 0; v < graph.VertexCount(); v++)
+    {
+        coords[v] = { (double)(v % kWidth), (double)(v / kWidth) };
+    }
+
+    mt19937 rng{ 7 };
+    uniform_int_distribution<int> vertexDist{ 0, graph.VertexCount() - 1 };
+
+    vector<pair<int, int>> queries(kQueryCount);
+
+    for (auto& [source, target] : queries)
+    {
+        source = vertexDist(rng);
+        target = vertexDist(rng);
+    }
+
+    auto startTime = MyClock::now();
+
+    LandmarkHeuristic landmarks{ graph, reverse, kLandmarks };
+
+    auto endTime = MyClock::now();
+
+    cout << "V : " << graph.VertexCount() << ", E : " << graph.EdgeCount() << '\n';
+    cout << "ALT preprocessing(" << kLandmarks << " landmarks) : " << chrono::duration_cast<MySecond>(endTime - startTime).count() << "s\n\n";
+
+    DijkstraQuery dijkstra{ graph };
+    BidirectionalDijkstraQuery bidirectional{ graph, reverse };
+    AStarQuery euclidean{ graph, EuclideanHeuristic{ &coords, 1.0 } };
+    AStarQuery alt{ graph, landmarks };
+
+    vector<int64_t> expected = Run("Dijkstra(early exit)", dijkstra, queries);
+
+    bool isValid = true;
+
+    isValid &= (expected == Run("Bidirectional       ", bidirectional, queries));
+    isValid &= (expected == Run("A*(Euclidean)       ", euclidean, queries));
+    isValid &= (expected == Run("A*(ALT)             ", alt, queries));
+
+    if (false == isValid)
+    {
+        cout << "Mismatch!\n";
+
+        return 1;
+    }
+
+    return 0;
+}
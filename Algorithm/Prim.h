@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+#include "CSRGraph.h"
+#include "IndexedHeap.h"
+#include "Kruskal.h"
+
+// 프림 알고리즘(MinimumSpanningTree.cpp의 주석 참고)
+//
+// 트리에 포함된 정점들에서 밖으로 나가는 간선 중 가장 가벼운 것을 골라서 트리를 키워나간다.
+// 트리 밖의 정점마다 "트리와 연결되는 가장 가벼운 간선의 가중치(key)"를 유지하면
+// 매번 key가 가장 작은 정점을 트리에 추가하고 그 정점의 간선으로 key를 갱신하면 된다(다익스트라와 같은 구조).
+//
+// 1. PrimHeap : key를 IndexedHeap으로 관리(DecreaseKey 사용), O(E log V)
+//               간선 배열을 정렬하는 크루스칼과 달리 정점 기준으로 움직이기 때문에 CSR 형태의 입력을 사용한다.
+// 2. PrimDense : 인접 행렬에서 key 배열을 매번 처음부터 끝까지 훑어서 최솟값을 찾는다, O(V^2)
+//                힙이 없고 행렬의 한 행을 순서대로 읽기 때문에 완전 그래프에 가까우면 O(E log V)보다 빠르다.
+//
+// Prim(vertexCount, edges)는 간선 밀도를 보고 둘 중 하나를 고른다.
+// - 힙 버전의 비용은 대략 E * log2(V), 행렬 버전의 비용은 V^2(행렬을 만드는 비용 포함)
+// - E * log2(V) >= kDenseRatio * V^2라면 행렬 버전을 사용한다.
+//   힙 연산 하나가 행렬의 원소 하나를 읽는 것보다 비싸기 때문에 실제 역전 지점은 비용 식만 보고 예상한 것보다 앞에 있다.
+//   (kDenseRatio는 PrimBenchmark.cpp로 측정해서 정한 값이며 V = 4096에서 밀도가 40% 정도일 때 역전되었다.
+//    환경에 따라 조정이 필요할 수 있음.)
+//
+// 그래프가 연결되어 있지 않다면 트리에 포함되지 않은 정점에서 다시 시작해서 최소 신장 포레스트를 구한다.
+
+constexpr int kPrimNoEdge = std::numeric_limits<int>::max();
+
+// graph는 무방향 그래프(CSRGraph의 undirected 옵션으로 만든 그래프)여야 한다.
+inline SpanningTree PrimHeap(const CSRGraph<int>& graph)
+{
+    int vertexCount = graph.VertexCount();
+
+    SpanningTree tree;
+
+    tree.edges.reserve(std::max(0, vertexCount - 1));
+
+    std::vector<int>  key(vertexCount, kPrimNoEdge);
+    std::vector<int>  parent(vertexCount, -1);
+    std::vector<bool> inTree(vertexCount, false);
+
+    IndexedHeap<int> heap{ vertexCount };
+
+    for (int start = 0; start < vertexCount; start++)
+    {
+        if (true == inTree[start])
+            continue;
+
+        key[start] = 0;
+        heap.Push(start, 0);
+
+        while (false == heap.Empty())
+        {
+            auto [weight, here] = heap.Pop();
+
+            inTree[here] = true;
+
+            if (-1 != parent[here])
+            {
+                tree.weight += weight;
+                tree.edges.push_back({ parent[here], here, weight });
+            }
+
+            for (size_t idx = graph.Begin(here); idx < graph.End(here); idx++)
+            {
+                int to = graph.Target(idx);
+                int w  = graph.Weight(idx);
+
+                if (true == inTree[to] || w >= key[to])
+                    continue;
+
+                key[to]    = w;
+                parent[to] = here;
+
+                heap.PushOrDecrease(to, w);
+            }
+        }
+    }
+
+    return tree;
+}
+
+// matrix : vertexCount * vertexCount 크기의 행 우선 인접 행렬(간선이 없으면 kPrimNoEdge)
+inline SpanningTree PrimDense(int vertexCount, const std::vector<int>& matrix)
+{
+    SpanningTree tree;
+
+    tree.edges.reserve(std::max(0, vertexCount - 1));
+
+    std::vector<int>  key(vertexCount, kPrimNoEdge);
+    std::vector<int>  parent(vertexCount, -1);
+    std::vector<bool> inTree(vertexCount, false);
+
+    for (int step = 0; step < vertexCount; step++)
+    {
+        // 트리 밖에서 key가 가장 작은 정점
+        int here = -1;
+
+        for (int v = 0; v < vertexCount; v++)
+        {
+            if (false == inTree[v] && (-1 == here || key[v] < key[here]))
+            {
+                here = v;
+            }
+        }
+
+        inTree[here] = true;
+
+        // kPrimNoEdge라면 새로운 컴포넌트의 시작점이다.
+        if (-1 != parent[here])
+        {
+            tree.weight += key[here];
+            tree.edges.push_back({ parent[here], here, key[here] });
+        }
+
+        const int* row = &matrix[(size_t)here * vertexCount];
+
+        for (int to = 0; to < vertexCount; to++)
+        {
+            if (false == inTree[to] && row[to] < key[to])
+            {
+                key[to]    = row[to];
+                parent[to] = here;
+            }
+        }
+    }
+
+    return tree;
+}
+
+// 밀도에 따라 PrimHeap()과 PrimDense() 중 하나를 고른다.
+inline SpanningTree Prim(int vertexCount, const std::vector<GraphEdge>& edges)
+{
+    constexpr double kDenseRatio = 2.5;
+
+    double heapCost  = (double)edges.size() * std::log2(std::max(2, vertexCount));
+    double denseCost = (double)vertexCount * vertexCount * kDenseRatio;
+
+    if (heapCost < denseCost)
+        return PrimHeap(CSRGraph<int>{ vertexCount, edges, true });
+
+    std::vector<int> matrix((size_t)vertexCount * vertexCount, kPrimNoEdge);
+
+    // 같은 정점 쌍에 간선이 여러 개라면 가장 가벼운 것만 남긴다.
+    for (const GraphEdge& edge : edges)
+    {
+        if (edge.from == edge.to)
+            continue;
+
+        int& forward  = matrix[(size_t)edge.from * vertexCount + edge.to];
+        int& backward = matrix[(size_t)edge.to * vertexCount + edge.from];
+
+        forward  = std::min(forward, edge.weight);
+        backward = std::min(backward, edge.weight);
+    }
+
+    return PrimDense(vertexCount, matrix);
+}
@@ -0,0 +1,122 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "GraphGenerator.h"
+#include "Kruskal.h"
+#include "Prim.h"
+
+// Prim.h 측정
+//
+// 정점 4096개에서 간선 밀도를 바꿔가며 다음을 비교한다.
+// - PrimHeap     : CSR 변환 포함
+// - PrimDense    : 인접 행렬 생성 포함
+// - Prim         : 밀도에 따라 자동 선택
+// - KruskalRadix : 비교용
+//
+// 밀도가 높을수록 PrimDense()가 유리해지는 지점을 보고 Prim.h의 kDenseRatio를 정한다.
+// 모든 결과의 가중치 합이 같은지 확인한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int kVertexCount = 4'096;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// 모든 정점 쌍 중 density 비율만큼 간선을 만든다(1.0이면 완전 그래프).
+vector<GraphEdge> MakeDenseGraph(int vertexCount, double density, uint32_t seed = 1)
+{
+    mt19937 rng{ seed };
+    uniform_real_distribution<double> pickDist{ 0.0, 1.0 };
+    uniform_int_distribution<int>     weightDist{ 1, 1'000'000 };
+
+    vector<GraphEdge> edges;
+
+    for (int from = 0; from < vertexCount; from++)
+    {
+        for (int to = from + 1; to < vertexCount; to++)
+        {
+            if (pickDist(rng) < density)
+            {
+                edges.push_back({ from, to, weightDist(rng) });
+            }
+        }
+    }
+
+    return edges;
+}
+
+int main()
+{
+    for (double density : { 0.002, 0.01, 0.05, 0.2, 0.5, 1.0 })
+    {
+        vector<GraphEdge> edges = MakeDenseGraph(kVertexCount, density);
+
+        // 연결 그래프가 되도록 경로를 하나 깔아둔다.
+        for (int v = 1; v < kVertexCount; v++)
+        {
+            edges.push_back({ v - 1, v, 1'000'000 });
+        }
+
+        SpanningTree heap;
+        SpanningTree dense;
+        SpanningTree automatic;
+        SpanningTree kruskal;
+
+        double heapTime = Measure([&] { heap = PrimHeap(CSRGraph<int>{ kVertexCount, edges, true }); });
+
+        double denseTime = Measure([&] {
+            vector<int> matrix((size_t)kVertexCount * kVertexCount, kPrimNoEdge);
+
+            // Prim()과 같은 입력이 되도록 자기 자신으로 향하는 간선은 건너뛴다.
+            for (const GraphEdge& edge : edges)
+            {
+                if (edge.from == edge.to)
+                    continue;
+
+                int& forward  = matrix[(size_t)edge.from * kVertexCount + edge.to];
+                int& backward = matrix[(size_t)edge.to * kVertexCount + edge.from];
+
+                forward  = min(forward, edge.weight);
+                backward = min(backward, edge.weight);
+            }
+
+            dense = PrimDense(kVertexCount, matrix);
+        });
+
+        double autoTime = Measure([&] { automatic = Prim(kVertexCount, edges); });
+
+        vector<GraphEdge> work = edges;
+
+        double kruskalTime = Measure([&] { kruskal = KruskalRadix(kVertexCount, work); });
+
+        bool isValid = (heap.weight == dense.weight) && (dense.weight == automatic.weight) && (automatic.weight == kruskal.weight)
+                    && (heap.edges.size() == (size_t)kVertexCount - 1) && (dense.edges.size() == (size_t)kVertexCount - 1);
+
+        cout << "Density : " << density << ", E : " << edges.size()
+             << ", PrimHeap : " << heapTime << "s"
+             << ", PrimDense : " << denseTime << "s"
+             << ", Prim(auto) : " << autoTime << "s"
+             << ", KruskalRadix : " << kruskalTime << "s"
+             << (isValid ? "" : " (Mismatch!)") << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,299 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include <utility>
+
+// d-ary 우선순위 큐(핸들 기반 DecreaseKey 지원)
+// : 예전 PriorityQueue.cpp에 있던 int 전용 이진 힙을 템플릿으로 일반화한 것
+//
+// 예전 버전의 문제점
+// - int만 담을 수 있고 이진 최소 힙으로 고정되어 있다.
+// - UpdateValueAtIndex()는 힙 배열의 인덱스를 받는데 원소는 bubbleUp()과 sinkDown()을 거치면서 계속 위치가 바뀌기 때문에
+//   호출하는 쪽에서는 원하는 원소의 인덱스를 알 수가 없다.
+//
+// 개선 사항
+// - 값의 타입(T), 비교 함수(Compare), 자식 노드의 개수(Arity)를 템플릿 인자로 받는다.
+//   Compare(a, b)가 true라면 a가 먼저 나온다(기본값 std::less라면 최소 힙, std::priority_queue와 반대임).
+// - Enqueue()가 핸들을 반환한다. 핸들은 원소가 힙 안에서 어디로 이동하든 바뀌지 않는다.
+//   핸들 -> 힙 슬롯을 가리키는 위치 테이블(_pos)을 원소가 이동할 때마다 갱신하기 때문에
+//   Update(handle, value)나 DecreaseKey(handle, value)로 특정 원소의 값을 바로 바꿀 수 있다.
+//   꺼낸 원소의 핸들은 이후 Enqueue()에서 재사용된다.
+// - Heapify()로 여러 원소를 O(n)에 한 번에 넣는다(아래쪽 부모부터 sinkDown() 반복).
+//   하나씩 Enqueue()하면 O(n log n)이다.
+//
+// IndexedHeap.h와의 차이
+// - IndexedHeap은 호출하는 쪽이 ID(정점 번호 등)를 정하고 키만 저장한다(다익스트라, 프림처럼 ID 범위가 정해져 있을 때).
+// - PriorityQueue는 값 자체를 저장하고 핸들을 직접 발급한다(ID 범위를 미리 알 수 없을 때).
+//
+// Arity는 2, 4, 8 중에서 고르는 것이 좋다(나눗셈이 시프트 연산이 됨).
+// 4-ary 힙은 트리의 높이가 이진 힙의 절반이라서 bubbleUp()이 빠르고
+// 자식 4개가 한 캐시 라인에 모여 있기 때문에 sinkDown()에서 비교 횟수가 늘어나는 비용이 크지 않다.
+// 값이 크다면 캐시 라인 하나에 들어가는 자식의 수가 줄어들기 때문에 이진 힙이 나을 수도 있다.
+
+template <typename T, typename Compare = std::less<T>, int Arity = 4>
+class PriorityQueue
+{
+    static_assert(Arity >= 2, "Arity must be at least 2.");
+
+public:
+    using Handle = int;
+
+    static constexpr Handle kInvalidHandle = -1;
+
+private:
+    struct Node
+    {
+        T      value;
+        Handle handle;
+    };
+
+public:
+    explicit PriorityQueue(Compare compare = Compare{})
+        : _compare{ std::move(compare) }
+    { }
+
+public:
+    Handle Enqueue(T data)
+    {
+        Handle handle = this->allocHandle();
+
+        _heap.push_back({ std::move(data), handle });
+        _pos[handle] = (int)_heap.size() - 1;
+
+        this->bubbleUp((int)_heap.size() - 1);
+
+        return handle;
+    }
+
+    bool Dequeue(T* outData)
+    {
+        if (true == _heap.empty())
+            return false;
+
+        *outData = std::move(_heap[0].value);
+
+        this->removeTop();
+
+        return true;
+    }
+
+    // 기존 원소를 모두 지우고 [first, last) 범위로 힙을 구성한다.
+    // 범위의 i번째 원소에는 핸들 i가 부여된다.
+    template <typename InputIt>
+    void Heapify(InputIt first, InputIt last)
+    {
+        _heap.clear();
+        _pos.clear();
+        _freeHandles.clear();
+
+        for (; first != last; ++first)
+        {
+            Handle handle = (Handle)_heap.size();
+
+            _heap.push_back({ *first, handle });
+            _pos.push_back(handle);
+        }
+
+        if (_heap.size() < 2)
+            return;
+
+        // 자식이 있는 마지막 노드부터 거꾸로 내려보낸다.
+        for (int idx = ((int)_heap.size() - 2) / Arity; idx >= 0; idx--)
+        {
+            this->sinkDown(idx);
+        }
+    }
+
+    // 값이 바뀐 방향에 따라 위나 아래로 이동한다(예전 PriorityQueue.cpp의 UpdateValueAtIndex()에 해당).
+    void Update(Handle handle, T newValue)
+    {
+        int slot = _pos[handle];
+
+        bool isPromoted = _compare(newValue, _heap[slot].value);
+
+        _heap[slot].value = std::move(newValue);
+
+        if (true == isPromoted)
+        {
+            this->bubbleUp(slot);
+        }
+        else
+        {
+            this->sinkDown(slot);
+        }
+    }
+
+    // 우선순위가 높아진 경우에만 사용(위로만 이동)
+    void DecreaseKey(Handle handle, T newValue)
+    {
+        int slot = _pos[handle];
+
+        _heap[slot].value = std::move(newValue);
+
+        this->bubbleUp(slot);
+    }
+
+    // 꺼내지 않은 원소를 제거한다.
+    void Erase(Handle handle)
+    {
+        int slot = _pos[handle];
+
+        // 맨 위까지 올린 다음 꺼낸다(비교 없이 이동).
+        while (slot > 0)
+        {
+            int parent = (slot - 1) / Arity;
+
+            this->swapNodes(slot, parent);
+
+            slot = parent;
+        }
+
+        this->removeTop();
+    }
+
+    void Clear()
+    {
+        for (const Node& node : _heap)
+        {
+            _pos[node.handle] = kInvalidHandle;
+            _freeHandles.push_back(node.handle);
+        }
+
+        _heap.clear();
+    }
+
+    // 힙 배열 순서대로 (값, 핸들)을 넘긴다.
+    template <typename Func>
+    void ForEach(Func&& func) const
+    {
+        for (const Node& node : _heap)
+        {
+            func(node.value, node.handle);
+        }
+    }
+
+public:
+    const T& Top() const { return _heap[0].value; }
+
+    bool     Contains(Handle handle) const { return handle >= 0 && handle < (Handle)_pos.size() && kInvalidHandle != _pos[handle]; }
+    const T& ValueOf(Handle handle) const  { return _heap[_pos[handle]].value; }
+
+    bool Empty() const { return _heap.empty(); }
+    int  Count() const { return (int)_heap.size(); }
+
+private:
+    Handle allocHandle()
+    {
+        if (false == _freeHandles.empty())
+        {
+            Handle handle = _freeHandles.back();
+            _freeHandles.pop_back();
+
+            return handle;
+        }
+
+        _pos.push_back(kInvalidHandle);
+
+        return (Handle)_pos.size() - 1;
+    }
+
+    void removeTop()
+    {
+        Handle top = _heap[0].handle;
+
+        _pos[top] = kInvalidHandle;
+        _freeHandles.push_back(top);
+
+        if (_heap.size() > 1)
+        {
+            _heap[0] = std::move(_heap.back());
+            _pos[_heap[0].handle] = 0;
+        }
+
+        _heap.pop_back();
+
+        if (false == _heap.empty())
+        {
+            this->sinkDown(0);
+        }
+    }
+
+    void swapNodes(int lhs, int rhs)
+    {
+        std::swap(_heap[lhs], _heap[rhs]);
+
+        _pos[_heap[lhs].handle] = lhs;
+        _pos[_heap[rhs].handle] = rhs;
+    }
+
+    // 힙 관련 함수
+    // 원소를 옮길 때마다 _pos도 같이 갱신해야 한다(swap 대신 빈 자리를 옮기는 방식 사용).
+    void bubbleUp(int idx)
+    {
+        Node item = std::move(_heap[idx]);
+
+        while (idx > 0)
+        {
+            int parent = (idx - 1) / Arity;
+
+            // 부모가 먼저 나와야 하거나 같으면 종료
+            if (false == _compare(item.value, _heap[parent].value))
+                break;
+
+            _heap[idx] = std::move(_heap[parent]);
+            _pos[_heap[idx].handle] = idx;
+
+            idx = parent;
+        }
+
+        _pos[item.handle] = idx;
+        _heap[idx] = std::move(item);
+    }
+
+    void sinkDown(int idx)
+    {
+        Node item = std::move(_heap[idx]);
+
+        int count = (int)_heap.size();
+
+        while (true)
+        {
+            int firstChild = idx * Arity + 1;
+
+            if (firstChild >= count)
+                break;
+
+            int lastChild = firstChild + Arity < count ? firstChild + Arity : count;
+            int nextChild = firstChild;
+
+            for (int child = firstChild + 1; child < lastChild; child++)
+            {
+                if (true == _compare(_heap[child].value, _heap[nextChild].value))
+                {
+                    nextChild = child;
+                }
+            }
+
+            // 자식이 먼저 나와야 하는 경우가 아니면 종료
+            if (false == _compare(_heap[nextChild].value, item.value))
+                break;
+
+            _heap[idx] = std::move(_heap[nextChild]);
+            _pos[_heap[idx].handle] = idx;
+
+            idx = nextChild;
+        }
+
+        _pos[item.handle] = idx;
+        _heap[idx] = std::move(item);
+    }
+
+private:
+    std::vector<Node>   _heap;        // 값, 핸들
+    std::vector<int>    _pos;         // 핸들 -> 힙 슬롯
+    std::vector<Handle> _freeHandles; // 재사용할 핸들
+
+    [[no_unique_address]] Compare _compare;
+};
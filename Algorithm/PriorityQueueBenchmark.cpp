@@ -0,0 +1,249 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <queue>
+#include <vector>
+#include <functional>
+
+#include "PriorityQueue.h"
+
+// PriorityQueue.h 측정
+//
+// std::priority_queue와 PriorityQueue<int, std::less<int>, Arity>(Arity = 2, 4, 8)를 비교한다.
+//
+// 1. Push + Pop    : 원소 1000만 개를 하나씩 넣고 모두 꺼낸다.
+// 2. Heapify + Pop : 원소 1000만 개로 한 번에 힙을 만들고(O(n)) 모두 꺼낸다.
+//                    (std::priority_queue는 범위를 받는 생성자(내부적으로 make_heap())를 사용)
+// 3. DecreaseKey   : 원소 100만 개를 넣고 무작위 원소의 값을 400만 번 낮춘 다음 모두 꺼낸다.
+//                    std::priority_queue는 값을 바꿀 수 없기 때문에 새 값을 다시 넣고
+//                    꺼낼 때 최신 값이 아니면 버리는 방식(lazy deletion)을 사용한다.
+//
+// PriorityQueue는 위치 테이블(핸들 -> 슬롯)을 같이 갱신하기 때문에 원소를 옮기는 비용이 std::priority_queue보다 크다.
+// 대신 DecreaseKey가 필요한 상황에서는 힙의 크기가 늘어나지 않는다.
+//
+// 꺼낸 순서로 계산한 체크섬이 모두 같아야 한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int    kCount         = 10'000'000;
+constexpr int    kDecreaseCount = 1'000'000;
+constexpr size_t kDecreaseOps   = 4'000'000;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// 꺼낸 순서가 같아야 값이 같아진다.
+struct Checksum
+{
+    uint64_t value = 0;
+
+    void Add(int data) { value = value * 1'000'003 + (uint64_t)data; }
+};
+
+struct DecreaseOp
+{
+    int id;
+    int value;
+};
+
+template <int Arity>
+void RunPriorityQueue(const vector<int>& values, const vector<int>& decreaseValues, const vector<DecreaseOp>& ops, const uint64_t (&expected)[3])
+{
+    using Queue = PriorityQueue<int, std::less<int>, Arity>;
+
+    Checksum pushSum;
+    Checksum heapifySum;
+    Checksum decreaseSum;
+
+    double pushTime = Measure([&] {
+        Queue pq;
+
+        for (int value : values)
+        {
+            pq.Enqueue(value);
+        }
+
+        int top;
+
+        while (true == pq.Dequeue(&top))
+        {
+            pushSum.Add(top);
+        }
+    });
+
+    double heapifyTime = Measure([&] {
+        Queue pq;
+
+        pq.Heapify(values.begin(), values.end());
+
+        int top;
+
+        while (true == pq.Dequeue(&top))
+        {
+            heapifySum.Add(top);
+        }
+    });
+
+    double decreaseTime = Measure([&] {
+        Queue pq;
+
+        // 핸들 i가 i번째 원소를 가리킨다.
+        pq.Heapify(decreaseValues.begin(), decreaseValues.end());
+
+        for (const DecreaseOp& op : ops)
+        {
+            if (op.value < pq.ValueOf(op.id))
+            {
+                pq.DecreaseKey(op.id, op.value);
+            }
+        }
+
+        int top;
+
+        while (true == pq.Dequeue(&top))
+        {
+            decreaseSum.Add(top);
+        }
+    });
+
+    bool isValid = (pushSum.value == expected[0]) && (heapifySum.value == expected[1]) && (decreaseSum.value == expected[2]);
+
+    cout << "PriorityQueue<" << Arity << ">     : Push + Pop " << pushTime << "s, Heapify + Pop " << heapifyTime
+         << "s, DecreaseKey " << decreaseTime << "s" << (isValid ? "" : " (Mismatch!)") << '\n';
+}
+
+int main()
+{
+    mt19937 rng{ 1 };
+    uniform_int_distribution<int> valueDist{ 0, 1'000'000'000 };
+
+    vector<int> values(kCount);
+
+    for (int& value : values)
+    {
+        value = valueDist(rng);
+    }
+
+    vector<int> decreaseValues(kDecreaseCount);
+
+    for (int& value : decreaseValues)
+    {
+        value = valueDist(rng);
+    }
+
+    // 무작위 원소를 무작위 값으로 낮춘다(기존 값보다 크다면 건너뜀).
+    vector<DecreaseOp> ops(kDecreaseOps);
+
+    {
+        uniform_int_distribution<int> idDist{ 0, kDecreaseCount - 1 };
+
+        for (DecreaseOp& op : ops)
+        {
+            op.id    = idDist(rng);
+            op.value = valueDist(rng);
+        }
+    }
+
+    cout << "Elements : " << kCount << ", DecreaseKey : " << kDecreaseCount << " elements, " << kDecreaseOps << " ops\n";
+
+    // std::priority_queue(최소 힙으로 사용)
+    uint64_t expected[3] = {};
+
+    {
+        using StdQueue = priority_queue<int, vector<int>, greater<int>>;
+
+        Checksum pushSum;
+        Checksum heapifySum;
+        Checksum decreaseSum;
+
+        double pushTime = Measure([&] {
+            StdQueue pq;
+
+            for (int value : values)
+            {
+                pq.push(value);
+            }
+
+            while (false == pq.empty())
+            {
+                pushSum.Add(pq.top());
+                pq.pop();
+            }
+        });
+
+        double heapifyTime = Measure([&] {
+            StdQueue pq{ values.begin(), values.end() };
+
+            while (false == pq.empty())
+            {
+                heapifySum.Add(pq.top());
+                pq.pop();
+            }
+        });
+
+        double decreaseTime = Measure([&] {
+            using Item = pair<int, int>; // 값, ID
+
+            priority_queue<Item, vector<Item>, greater<Item>> pq;
+
+            vector<int> current = decreaseValues;
+
+            for (int id = 0; id < kDecreaseCount; id++)
+            {
+                pq.push({ current[id], id });
+            }
+
+            for (const DecreaseOp& op : ops)
+            {
+                if (op.value < current[op.id])
+                {
+                    current[op.id] = op.value;
+
+                    pq.push({ op.value, op.id });
+                }
+            }
+
+            while (false == pq.empty())
+            {
+                auto [value, id] = pq.top();
+                pq.pop();
+
+                // 최신 값이 아니면 버린다.
+                if (value != current[id])
+                    continue;
+
+                current[id] = -1;
+
+                decreaseSum.Add(value);
+            }
+        });
+
+        expected[0] = pushSum.value;
+        expected[1] = heapifySum.value;
+        expected[2] = decreaseSum.value;
+
+        cout << "std::priority_queue : Push + Pop " << pushTime << "s, Heapify + Pop " << heapifyTime
+             << "s, DecreaseKey " << decreaseTime << "s\n";
+    }
+
+    RunPriorityQueue<2>(values, decreaseValues, ops, expected);
+    RunPriorityQueue<4>(values, decreaseValues, ops, expected);
+    RunPriorityQueue<8>(values, decreaseValues, ops, expected);
+
+    return 0;
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+#include <functional>
+#include <utility>
+
+// 큰 데이터를 담는 우선순위 큐(슬롯 풀 + {키, 슬롯} 힙)
+// : _Study/priority_queue_but_move_or_copy.cpp에서 다룬 문제를 해결하기 위한 구조
+//
+// std::priority_queue에 큰 구조체를 넣으면 push(), pop()을 할 때마다 힙 정렬을 위해 원소 자체를 이동(혹은 복사)한다.
+// top()은 const 참조를 반환하기 때문에 꺼내려면 복사를 한 번 더 해야 한다.
+// 위 파일에서 제안한 대로 포인터(shared_ptr, unique_ptr)를 넣으면 이동 비용은 줄지만 원소마다 동적 할당이 일어난다.
+//
+// 그래서 데이터와 힙을 분리한다.
+// - 데이터는 생성할 때 한 번 할당해 둔 슬롯 배열(풀)에 직접 생성한다(Emplace()). 한 번 생성된 데이터는 꺼낼 때까지 움직이지 않는다.
+// - 힙에는 {키, 슬롯 번호}만 넣고 정렬한다. 원소를 옮기는 비용이 데이터의 크기와 상관없이 일정하다.
+// - Pop(&out)은 데이터를 out으로 한 번 이동하고 슬롯을 비운다(복사 없음).
+// - 빈 슬롯 번호는 스택으로 관리해서 다시 사용한다.
+//
+// 생성할 때 정한 용량(capacity)을 넘을 수 없으며 가득 찼다면 Emplace()가 false를 반환한다.
+// 생성 이후에는 Emplace(), Pop()을 아무리 반복해도 메모리 할당이 일어나지 않는다.
+// T는 복사할 수 없고 이동만 가능한 타입(move-only)이어도 된다.
+//
+// Compare(a, b)가 true라면 키 a가 먼저 나온다(PriorityQueue.h와 같은 규칙, 기본값은 최소 힙).
+
+template <typename T, typename Key = int64_t, typename Compare = std::less<Key>, int Arity = 4>
+class SlotPriorityQueue
+{
+    static_assert(Arity >= 2, "Arity must be at least 2.");
+
+    struct Entry
+    {
+        Key key;
+        int slot;
+    };
+
+    // 생성자를 호출하지 않은 T 크기의 공간
+    struct alignas(T) Slot
+    {
+        std::byte storage[sizeof(T)];
+    };
+
+public:
+    explicit SlotPriorityQueue(int capacity, Compare compare = Compare{})
+        : _capacity{ capacity }, _slots{ std::make_unique<Slot[]>(capacity) }, _compare{ std::move(compare) }
+    {
+        _heap.reserve(capacity);
+        _freeSlots.reserve(capacity);
+
+        // 작은 번호의 슬롯부터 사용하도록 거꾸로 넣는다.
+        for (int slot = capacity - 1; slot >= 0; slot--)
+        {
+            _freeSlots.push_back(slot);
+        }
+    }
+
+    ~SlotPriorityQueue()
+    {
+        this->Clear();
+    }
+
+    SlotPriorityQueue(const SlotPriorityQueue&) = delete;
+    SlotPriorityQueue& operator=(const SlotPriorityQueue&) = delete;
+
+public:
+    // 데이터를 슬롯에 바로 생성한다(가득 찼다면 false).
+    template <typename... Args>
+    bool Emplace(Key key, Args&&... args)
+    {
+        if (true == _freeSlots.empty())
+            return false;
+
+        int slot = _freeSlots.back();
+
+        // 생성자가 예외를 던지면 슬롯을 잃어버리지 않도록 생성에 성공한 다음에 꺼낸다.
+        std::construct_at(this->payload(slot), std::forward<Args>(args)...);
+
+        _freeSlots.pop_back();
+
+        _heap.push_back({ std::move(key), slot });
+
+        this->bubbleUp((int)_heap.size() - 1);
+
+        return true;
+    }
+
+    // 가장 우선순위가 높은 데이터를 outData로 이동한다(비어 있다면 false).
+    bool Pop(T* outData, Key* outKey = nullptr)
+    {
+        if (true == _heap.empty())
+            return false;
+
+        int slot = _heap[0].slot;
+
+        if (nullptr != outKey)
+        {
+            *outKey = std::move(_heap[0].key);
+        }
+
+        T* data = this->payload(slot);
+
+        *outData = std::move(*data);
+
+        std::destroy_at(data);
+
+        _freeSlots.push_back(slot);
+
+        // 마지막 원소를 맨 위로 올리고 내려보낸다.
+        if (_heap.size() > 1)
+        {
+            _heap[0] = std::move(_heap.back());
+        }
+
+        _heap.pop_back();
+
+        if (false == _heap.empty())
+        {
+            this->sinkDown(0);
+        }
+
+        return true;
+    }
+
+    void Clear()
+    {
+        for (const Entry& entry : _heap)
+        {
+            std::destroy_at(this->payload(entry.slot));
+
+            _freeSlots.push_back(entry.slot);
+        }
+
+        _heap.clear();
+    }
+
+public:
+    // 비어 있지 않을 때만 호출해야 한다.
+    const T&   Top() const    { return *this->payload(_heap[0].slot); }
+    T&         Top()          { return *this->payload(_heap[0].slot); }
+    const Key& TopKey() const { return _heap[0].key; }
+
+    bool Empty() const    { return _heap.empty(); }
+    bool Full() const     { return (int)_heap.size() == _capacity; }
+    int  Count() const    { return (int)_heap.size(); }
+    int  Capacity() const { return _capacity; }
+
+private:
+    T* payload(int slot) const
+    {
+        return std::launder(reinterpret_cast<T*>(_slots[slot].storage));
+    }
+
+    // 힙 관련 함수(IndexedHeap.h와 같이 빈 자리를 옮기는 방식)
+    // 옮기는 것은 {키, 슬롯}뿐이다.
+    void bubbleUp(int idx)
+    {
+        Entry item = std::move(_heap[idx]);
+
+        while (idx > 0)
+        {
+            int parent = (idx - 1) / Arity;
+
+            if (false == _compare(item.key, _heap[parent].key))
+                break;
+
+            _heap[idx] = std::move(_heap[parent]);
+
+            idx = parent;
+        }
+
+        _heap[idx] = std::move(item);
+    }
+
+    void sinkDown(int idx)
+    {
+        Entry item = std::move(_heap[idx]);
+
+        int count = (int)_heap.size();
+
+        while (true)
+        {
+            int firstChild = idx * Arity + 1;
+
+            if (firstChild >= count)
+                break;
+
+            int lastChild = firstChild + Arity < count ? firstChild + Arity : count;
+            int nextChild = firstChild;
+
+            for (int child = firstChild + 1; child < lastChild; child++)
+            {
+                if (true == _compare(_heap[child].key, _heap[nextChild].key))
+                {
+                    nextChild = child;
+                }
+            }
+
+            if (false == _compare(_heap[nextChild].key, item.key))
+                break;
+
+            _heap[idx] = std::move(_heap[nextChild]);
+
+            idx = nextChild;
+        }
+
+        _heap[idx] = std::move(item);
+    }
+
+private:
+    int _capacity;
+
+    std::unique_ptr<Slot[]> _slots;     // 데이터(풀)
+    std::vector<Entry>      _heap;      // 키, 슬롯
+    std::vector<int>        _freeSlots; // 비어 있는 슬롯 번호
+
+    [[no_unique_address]] Compare _compare;
+};
@@ -0,0 +1,348 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <queue>
+#include <memory>
+#include <vector>
+#include <new>
+#include <cstdlib>
+#include <cstring>
+
+#include "SlotPriorityQueue.h"
+
+// SlotPriorityQueue.h 측정
+//
+// _Study/priority_queue_but_move_or_copy.cpp처럼 복사, 이동 연산이 일어날 때마다 기록하는 256바이트 크기의 예약 데이터를 사용한다.
+// 출력하는 대신 횟수를 세고 전역 operator new를 바꿔서 측정 구간의 동적 할당 횟수도 같이 센다.
+//
+// - std::priority_queue<Reservation>    : 데이터를 힙에 직접 넣음(꺼낼 때는 top()을 복사한 다음 pop())
+// - std::priority_queue<{키, unique_ptr}> : 위 파일에서 제안한 포인터 방식(원소마다 동적 할당)
+// - SlotPriorityQueue<Reservation>      : Emplace()로 슬롯에 생성, Pop(&out)으로 이동
+//
+// 1. Fill + Drain : 100만 개를 넣은 다음 모두 꺼낸다.
+// 2. Steady       : 1만 개가 들어 있는 상태에서 "하나 꺼내고 하나 넣기"를 200만 번 반복한다(타이머, 예약 시스템).
+//
+// 꺼낸 순서로 계산한 체크섬이 모두 같아야 한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int    kFillCount   = 1'000'000;
+constexpr int    kSteadyCount = 10'000;
+constexpr size_t kSteadyOps   = 2'000'000;
+
+// 같은 시간이 있으면 꺼내는 순서가 구현마다 달라질 수 있기 때문에 시간의 하위 비트에 순번을 넣어서 겹치지 않게 만든다.
+constexpr int kSeqBits = 21; // 2^21 > kSteadyCount + kSteadyOps
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// 동적 할당 횟수
+size_t gAllocCount = 0;
+
+void* operator new(size_t size)
+{
+    gAllocCount++;
+
+    if (void* ptr = std::malloc(size))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+struct OpCounter
+{
+    size_t copies = 0;
+    size_t moves  = 0;
+};
+
+OpCounter gCounter;
+
+struct Reservation
+{
+    Reservation(int64_t time, int id)
+        : time{ time }, id{ id }
+    {
+        std::memset(memo, id & 0xFF, sizeof(memo));
+    }
+
+    Reservation(const Reservation& rhs)
+        : time{ rhs.time }, id{ rhs.id }
+    {
+        std::memcpy(memo, rhs.memo, sizeof(memo));
+
+        gCounter.copies++;
+    }
+
+    Reservation(Reservation&& rhs) noexcept
+        : time{ rhs.time }, id{ rhs.id }
+    {
+        std::memcpy(memo, rhs.memo, sizeof(memo));
+
+        gCounter.moves++;
+    }
+
+    Reservation& operator=(const Reservation& rhs)
+    {
+        time = rhs.time;
+        id   = rhs.id;
+        std::memcpy(memo, rhs.memo, sizeof(memo));
+
+        gCounter.copies++;
+
+        return *this;
+    }
+
+    Reservation& operator=(Reservation&& rhs) noexcept
+    {
+        time = rhs.time;
+        id   = rhs.id;
+        std::memcpy(memo, rhs.memo, sizeof(memo));
+
+        gCounter.moves++;
+
+        return *this;
+    }
+
+    // std::priority_queue용(시간이 빠른 것이 먼저 나오도록 반대로 비교)
+    bool operator<(const Reservation& rhs) const
+    {
+        return time > rhs.time;
+    }
+
+    int64_t time = 0;
+    int     id   = 0;
+
+    char memo[244];
+};
+
+static_assert(sizeof(Reservation) == 256);
+
+struct Checksum
+{
+    uint64_t value = 0;
+
+    void Add(const Reservation& data) { value = value * 1'000'003 + (uint64_t)data.time * 31 + (uint64_t)data.id; }
+};
+
+struct Schedule
+{
+    vector<int64_t> fillTimes;
+    vector<int64_t> steadyDelays; // 꺼낸 시간에서 얼마나 뒤에 다시 넣을지
+};
+
+struct Result
+{
+    double    fillTime   = 0.0;
+    double    steadyTime = 0.0;
+    OpCounter fillOps;
+    OpCounter steadyOps;
+    size_t    fillAllocs   = 0;
+    size_t    steadyAllocs = 0;
+    uint64_t  checksum     = 0;
+};
+
+// Queue 어댑터 : Push(time, id), Pop(Reservation*)
+template <typename Queue>
+Result Run(const Schedule& schedule)
+{
+    Result result;
+
+    Checksum sum;
+
+    // Fill + Drain
+    {
+        Queue queue{ kFillCount };
+
+        gCounter    = {};
+        gAllocCount = 0;
+
+        result.fillTime = Measure([&] {
+            for (int id = 0; id < kFillCount; id++)
+            {
+                queue.Push(schedule.fillTimes[id], id);
+            }
+
+            Reservation out{ 0, 0 };
+
+            while (true == queue.Pop(&out))
+            {
+                sum.Add(out);
+            }
+        });
+
+        result.fillOps    = gCounter;
+        result.fillAllocs = gAllocCount;
+    }
+
+    // Steady
+    {
+        Queue queue{ kSteadyCount };
+
+        for (int id = 0; id < kSteadyCount; id++)
+        {
+            queue.Push((schedule.steadyDelays[id] << kSeqBits) | id, id);
+        }
+
+        gCounter    = {};
+        gAllocCount = 0;
+
+        result.steadyTime = Measure([&] {
+            Reservation out{ 0, 0 };
+
+            for (size_t op = 0; op < kSteadyOps; op++)
+            {
+                queue.Pop(&out);
+
+                sum.Add(out);
+
+                // 꺼낸 시간보다 뒤에 새 예약을 넣는다.
+                int64_t delay = schedule.steadyDelays[op % schedule.steadyDelays.size()];
+                int64_t seq   = (int64_t)(kSteadyCount + op);
+
+                queue.Push((((out.time >> kSeqBits) + delay) << kSeqBits) | seq, (int)op);
+            }
+        });
+
+        result.steadyOps    = gCounter;
+        result.steadyAllocs = gAllocCount;
+    }
+
+    result.checksum = sum.value;
+
+    return result;
+}
+
+struct StdQueue
+{
+    explicit StdQueue(int) { }
+
+    void Push(int64_t time, int id) { pq.emplace(time, id); }
+
+    bool Pop(Reservation* out)
+    {
+        if (true == pq.empty())
+            return false;
+
+        // top()이 const 참조라서 이동할 수 없다.
+        *out = pq.top();
+        pq.pop();
+
+        return true;
+    }
+
+    priority_queue<Reservation> pq;
+};
+
+struct StdPointerQueue
+{
+    struct Item
+    {
+        int64_t time;
+
+        unique_ptr<Reservation> data;
+
+        bool operator<(const Item& rhs) const { return time > rhs.time; }
+    };
+
+    explicit StdPointerQueue(int) { }
+
+    void Push(int64_t time, int id) { pq.push({ time, make_unique<Reservation>(time, id) }); }
+
+    bool Pop(Reservation* out)
+    {
+        if (true == pq.empty())
+            return false;
+
+        // 원소는 const라서 unique_ptr을 꺼낼 수 없지만 가리키는 데이터는 이동할 수 있다.
+        *out = std::move(*pq.top().data);
+        pq.pop();
+
+        return true;
+    }
+
+    priority_queue<Item> pq;
+};
+
+struct SlotQueue
+{
+    explicit SlotQueue(int capacity)
+        : pq{ capacity }
+    { }
+
+    void Push(int64_t time, int id) { pq.Emplace(time, time, id); }
+
+    bool Pop(Reservation* out) { return pq.Pop(out); }
+
+    SlotPriorityQueue<Reservation> pq;
+};
+
+void Print(const char* name, const Result& result, uint64_t expected)
+{
+    cout << name << '\n';
+    cout << "  Fill + Drain : " << result.fillTime << "s, Copies : " << result.fillOps.copies << ", Moves : " << result.fillOps.moves
+         << ", Allocations : " << result.fillAllocs << '\n';
+    cout << "  Steady       : " << result.steadyTime << "s, Copies : " << result.steadyOps.copies << ", Moves : " << result.steadyOps.moves
+         << ", Allocations : " << result.steadyAllocs << (result.checksum == expected ? "" : " (Mismatch!)") << '\n';
+}
+
+int main()
+{
+    Schedule schedule;
+
+    {
+        mt19937_64 rng{ 1 };
+        uniform_int_distribution<int64_t> timeDist{ 1, 1'000'000 };
+
+        schedule.fillTimes.resize(kFillCount);
+
+        for (int id = 0; id < kFillCount; id++)
+        {
+            schedule.fillTimes[id] = (timeDist(rng) << kSeqBits) | id;
+        }
+
+        schedule.steadyDelays.resize(kSteadyCount);
+
+        for (int64_t& delay : schedule.steadyDelays)
+        {
+            delay = timeDist(rng);
+        }
+    }
+
+    cout << "sizeof(Reservation) : " << sizeof(Reservation) << ", Fill : " << kFillCount
+         << ", Steady : " << kSteadyCount << " elements, " << kSteadyOps << " ops\n";
+
+    Result stdResult     = Run<StdQueue>(schedule);
+    Result pointerResult = Run<StdPointerQueue>(schedule);
+    Result slotResult    = Run<SlotQueue>(schedule);
+
+    Print("std::priority_queue<Reservation>", stdResult, stdResult.checksum);
+    Print("std::priority_queue<{time, unique_ptr}>", pointerResult, stdResult.checksum);
+    Print("SlotPriorityQueue<Reservation>", slotResult, stdResult.checksum);
+
+    return 0;
+}
@@ -0,0 +1,317 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+#include "CSRGraph.h"
+#include "ThreadPool.h"
+#include "TopologicalSort.h"
+
+// 작업 그래프 실행기(Task graph executor)
+// : 위상 정렬(TopologicalSort.h)로 순서만 구하는 것이 아니라 의존 관계를 지키면서 작업을 실제로 병렬 실행한다.
+//
+// 빌드 단계나 작업 파이프라인을 위상 정렬 순서대로 하나씩 실행하면 서로 의존하지 않는 작업도 기다려야 한다.
+// 칸 알고리즘의 "진입 차수가 0이 되면 실행할 수 있다"는 조건을 그대로 여러 스레드에 적용하면 된다.
+//
+// 1. 작업마다 atomic<int> 진입 차수 카운터를 둔다.
+// 2. 작업이 끝나면 후속 작업의 카운터를 fetch_sub()로 줄이고 0이 된 작업을 자기 큐에 넣는다.
+//    (마지막으로 카운터를 줄인 스레드만 0을 보기 때문에 같은 작업이 두 번 들어가지 않는다.)
+// 3. 워커는 자기 큐의 뒤쪽에서 작업을 꺼낸다(방금 넣은 작업이라 캐시에 남아 있을 가능성이 높음).
+//    자기 큐가 비었다면 다른 워커의 큐 앞쪽에서 작업을 훔쳐 온다(work stealing).
+//    한 워커에 작업이 몰려도 놀고 있는 워커가 가져가기 때문에 부하가 자동으로 분산된다.
+//
+// 워커는 ThreadPool::ParallelFor()로 스레드 개수만큼 실행한다(인덱스가 워커 번호).
+// 큐는 워커마다 뮤텍스 하나로 보호한다. 대부분의 접근이 자기 큐에서 일어나기 때문에 경쟁은 훔칠 때만 생긴다.
+// 할 일이 없는 워커는 조건 변수에서 잠들고 새 작업이 큐에 들어오거나 모든 작업이 끝나면 깨어난다.
+// 작업 하나가 몇 초씩 걸리는 빌드 단계 같은 경우에도 나머지 워커가 CPU를 쓰면서 기다리지 않는다.
+// 큐에 들어 있는 작업의 수(ready)와 잠든 워커의 수(sleepers)를 atomic으로 따로 세기 때문에
+// 잠든 워커가 없다면 작업을 넣을 때 뮤텍스를 잡지 않는다.
+//
+// 실행이 끝나면 작업마다 시작 시각, 실행 시간, 실행한 워커를 기록하고
+// 측정한 실행 시간으로 임계 경로(Critical path, 실행 시간의 합이 가장 큰 의존 경로)를 계산한다.
+// 스레드를 아무리 늘려도 전체 실행 시간은 임계 경로의 길이보다 짧아질 수 없다.
+//
+// 주의 사항
+// - 작업 안에서 같은 ThreadPool의 ParallelFor()를 호출하면 안 된다(풀이 이미 사용 중임).
+// - 작업은 예외를 던지지 않아야 한다.
+
+struct TaskTiming
+{
+    double start    = 0.0; // Run()을 호출한 시점 기준(초)
+    double duration = 0.0;
+    int    worker   = -1;
+};
+
+struct TaskGraphReport
+{
+    double elapsed            = 0.0; // 전체 실행 시간
+    double totalWork          = 0.0; // 모든 작업의 실행 시간의 합
+    double criticalPathLength = 0.0;
+
+    std::vector<int>        criticalPath; // 임계 경로에 속한 작업(실행 순서)
+    std::vector<TaskTiming> timings;      // 작업 ID 기준
+
+    size_t steals = 0;
+};
+
+class TaskGraph
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct WorkerQueue
+    {
+        std::mutex      mutex;
+        std::deque<int> tasks;
+
+        void PushBack(int task)
+        {
+            std::lock_guard<std::mutex> lock{ mutex };
+
+            tasks.push_back(task);
+        }
+
+        bool PopBack(int& task)
+        {
+            std::lock_guard<std::mutex> lock{ mutex };
+
+            if (true == tasks.empty())
+                return false;
+
+            task = tasks.back();
+            tasks.pop_back();
+
+            return true;
+        }
+
+        bool PopFront(int& task)
+        {
+            std::lock_guard<std::mutex> lock{ mutex };
+
+            if (true == tasks.empty())
+                return false;
+
+            task = tasks.front();
+            tasks.pop_front();
+
+            return true;
+        }
+    };
+
+public:
+    // 작업 ID는 추가한 순서대로 0부터 부여한다.
+    int AddTask(std::function<void()> task)
+    {
+        _tasks.push_back(std::move(task));
+
+        return (int)_tasks.size() - 1;
+    }
+
+    // before가 끝난 다음에 after를 시작한다.
+    // 두 작업 모두 AddTask()로 이미 추가한 작업이어야 한다(아니라면 false).
+    bool AddDependency(int before, int after)
+    {
+        if (before < 0 || before >= this->TaskCount() || after < 0 || after >= this->TaskCount())
+            return false;
+
+        _edges.push_back({ before, after, 0 });
+
+        return true;
+    }
+
+    int TaskCount() const { return (int)_tasks.size(); }
+
+    // 사이클이 있다면 아무 작업도 실행하지 않고 false를 반환한다.
+    bool Run(ThreadPool& pool, TaskGraphReport& report)
+    {
+        int taskCount = this->TaskCount();
+
+        CSRGraph<int> graph{ taskCount, _edges };
+
+        std::vector<int> order;
+
+        if (false == KahnTopologicalSort(graph, order))
+            return false;
+
+        auto indegrees = std::make_unique<std::atomic<int>[]>(taskCount);
+
+        for (const CSRGraph<int>::Edge& edge : _edges)
+        {
+            indegrees[edge.to].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        int workerCount = pool.ThreadCount();
+
+        auto queues = std::make_unique<WorkerQueue[]>(workerCount);
+
+        // 처음부터 실행할 수 있는 작업은 워커마다 돌아가면서 나눠 준다.
+        int seeded = 0;
+
+        for (int task = 0; task < taskCount; task++)
+        {
+            if (0 == indegrees[task].load(std::memory_order_relaxed))
+            {
+                queues[seeded++ % workerCount].tasks.push_back(task);
+            }
+        }
+
+        report.timings.assign(taskCount, TaskTiming{});
+
+        std::atomic<int>    remaining = taskCount;
+        std::atomic<size_t> steals    = 0;
+
+        // 할 일이 없는 워커를 재우고 깨우는 데 사용한다.
+        // sleepers를 늘린 다음 ready를 확인하고(워커), ready를 늘린 다음 sleepers를 확인하기 때문에(작업을 넣는 쪽)
+        // 둘 중 하나는 반드시 상대방의 변경을 보게 된다(seq_cst). 그래서 깨우는 신호를 놓치지 않는다.
+        std::atomic<int>        ready    = seeded; // 큐에 들어 있는 작업의 수
+        std::atomic<int>        sleepers = 0;
+        std::mutex              idleMutex;
+        std::condition_variable idleCv;
+
+        Clock::time_point startTime = Clock::now();
+
+        pool.ParallelFor(workerCount, [&](size_t self) {
+            int task;
+
+            while (remaining.load(std::memory_order_acquire) > 0)
+            {
+                if (false == queues[self].PopBack(task))
+                {
+                    if (false == this->steal(queues.get(), workerCount, (int)self, task))
+                    {
+                        std::unique_lock<std::mutex> lock{ idleMutex };
+
+                        sleepers.fetch_add(1);
+
+                        idleCv.wait(lock, [&] { return ready.load() > 0 || 0 == remaining.load(); });
+
+                        sleepers.fetch_sub(1);
+
+                        continue;
+                    }
+
+                    steals.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                ready.fetch_sub(1);
+
+                Clock::time_point taskStart = Clock::now();
+
+                _tasks[task]();
+
+                Clock::time_point taskEnd = Clock::now();
+
+                report.timings[task] = { std::chrono::duration<double>(taskStart - startTime).count(),
+                                         std::chrono::duration<double>(taskEnd - taskStart).count(),
+                                         (int)self };
+
+                for (int next : graph.Targets(task))
+                {
+                    // 마지막 선행 작업을 끝낸 스레드가 후속 작업을 넣는다.
+                    if (1 == indegrees[next].fetch_sub(1, std::memory_order_acq_rel))
+                    {
+                        queues[self].PushBack(next);
+
+                        ready.fetch_add(1);
+
+                        // 잠든 워커가 wait()에 들어갈 때까지 뮤텍스를 잡고 있기 때문에 한 번 잡았다 놓은 다음 깨운다.
+                        if (sleepers.load() > 0)
+                        {
+                            { std::lock_guard<std::mutex> lock{ idleMutex }; }
+
+                            idleCv.notify_one();
+                        }
+                    }
+                }
+
+                // 후속 작업을 넣은 다음에 줄여야 다른 워커가 먼저 종료하지 않는다.
+                // 마지막 작업이었다면 잠든 워커를 모두 깨워서 종료하게 한다.
+                if (1 == remaining.fetch_sub(1, std::memory_order_acq_rel))
+                {
+                    { std::lock_guard<std::mutex> lock{ idleMutex }; }
+
+                    idleCv.notify_all();
+                }
+            }
+        });
+
+        report.elapsed = std::chrono::duration<double>(Clock::now() - startTime).count();
+        report.steals  = steals.load();
+
+        this->computeCriticalPath(graph, order, report);
+
+        return true;
+    }
+
+private:
+    bool steal(WorkerQueue* queues, int workerCount, int self, int& task)
+    {
+        for (int offset = 1; offset < workerCount; offset++)
+        {
+            if (true == queues[(self + offset) % workerCount].PopFront(task))
+                return true;
+        }
+
+        return false;
+    }
+
+    // 위상 정렬 순서대로 "그 작업에서 끝나는 가장 긴 경로"를 계산한다.
+    void computeCriticalPath(const CSRGraph<int>& graph, const std::vector<int>& order, TaskGraphReport& report)
+    {
+        int taskCount = this->TaskCount();
+
+        std::vector<double> finish(taskCount);
+        std::vector<int>    parent(taskCount, -1);
+
+        report.totalWork = 0.0;
+
+        for (int task = 0; task < taskCount; task++)
+        {
+            finish[task] = report.timings[task].duration;
+
+            report.totalWork += report.timings[task].duration;
+        }
+
+        for (int here : order)
+        {
+            for (int next : graph.Targets(here))
+            {
+                double candidate = finish[here] + report.timings[next].duration;
+
+                if (candidate > finish[next])
+                {
+                    finish[next] = candidate;
+                    parent[next] = here;
+                }
+            }
+        }
+
+        report.criticalPath.clear();
+        report.criticalPathLength = 0.0;
+
+        if (0 == taskCount)
+            return;
+
+        int last = (int)(std::max_element(finish.begin(), finish.end()) - finish.begin());
+
+        report.criticalPathLength = finish[last];
+
+        for (int task = last; -1 != task; task = parent[task])
+        {
+            report.criticalPath.push_back(task);
+        }
+
+        std::reverse(report.criticalPath.begin(), report.criticalPath.end());
+    }
+
+private:
+    std::vector<std::function<void()>> _tasks;
+    std::vector<CSRGraph<int>::Edge>   _edges;
+};
@@ -0,0 +1,208 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "GraphGenerator.h"
+#include "TaskGraph.h"
+
+// TaskGraph.h 측정
+//
+// 작업 2만 개, 의존 관계 8만 개의 DAG를 실행한다.
+// - Serial    : 위상 정렬 순서대로 한 스레드에서 실행(기존의 순차 실행기와 같은 방식)
+// - TaskGraph : 스레드 개수를 바꿔가며 실행
+//
+// 작업마다 정해진 횟수만큼 계산을 반복하고(몇 마이크로초에서 수십 마이크로초)
+// 결과값은 "자기 계산 결과 + 선행 작업들의 결과값의 합"으로 정한다.
+// 선행 작업이 끝나기 전에 실행되거나 선행 작업의 결과가 보이지 않으면 Serial과 값이 달라진다.
+// 기록된 시각으로도 모든 작업이 선행 작업이 끝난 다음에 시작했는지 확인한다.
+//
+// 스레드를 늘려도 전체 실행 시간은 임계 경로(Critical path)보다 짧아질 수 없다.
+// Parallelism(전체 작업량 / 임계 경로)이 기대할 수 있는 최대 속도 향상이다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int    kTaskCount       = 20'000;
+constexpr size_t kDependencyCount = 80'000;
+constexpr int    kDependencySpan  = 256;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+uint64_t Spin(uint64_t seed, int iterations)
+{
+    uint64_t state = seed | 1;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+    }
+
+    return state;
+}
+
+struct Workload
+{
+    vector<GraphEdge> edges;
+    vector<int>       iterations;
+
+    CSRGraph<int> predecessors; // 결과값을 합치기 위한 역방향 그래프
+
+    vector<uint64_t> values;
+
+    void RunTask(int task)
+    {
+        uint64_t value = Spin((uint64_t)task, iterations[task]);
+
+        for (int prev : predecessors.Targets(task))
+        {
+            value += values[prev];
+        }
+
+        values[task] = value;
+    }
+};
+
+bool IsValidSchedule(const vector<GraphEdge>& edges, const TaskGraphReport& report)
+{
+    for (const TaskTiming& timing : report.timings)
+    {
+        if (-1 == timing.worker)
+            return false;
+    }
+
+    for (const GraphEdge& edge : edges)
+    {
+        const TaskTiming& before = report.timings[edge.from];
+        const TaskTiming& after  = report.timings[edge.to];
+
+        if (after.start < before.start + before.duration)
+            return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    Workload workload;
+
+    workload.edges = MakeRandomDag(kTaskCount, kDependencyCount, kDependencySpan);
+
+    {
+        mt19937 rng{ 7 };
+        uniform_int_distribution<int> iterationDist{ 1'000, 20'000 };
+
+        workload.iterations.resize(kTaskCount);
+
+        for (int& iteration : workload.iterations)
+        {
+            iteration = iterationDist(rng);
+        }
+    }
+
+    workload.predecessors = CSRGraph<int>{ kTaskCount, workload.edges }.Transpose();
+
+    cout << "Tasks : " << kTaskCount << ", Dependencies : " << workload.edges.size() << '\n';
+
+    // 기존 방식 : 위상 정렬 순서대로 하나씩 실행
+    vector<uint64_t> expected;
+
+    {
+        vector<int> order;
+
+        KahnTopologicalSort(CSRGraph<int>{ kTaskCount, workload.edges }, order);
+
+        workload.values.assign(kTaskCount, 0);
+
+        double elapsed = Measure([&] {
+            for (int task : order)
+            {
+                workload.RunTask(task);
+            }
+        });
+
+        expected = workload.values;
+
+        cout << "Serial : " << elapsed << "s\n";
+    }
+
+    TaskGraph graph;
+
+    for (int task = 0; task < kTaskCount; task++)
+    {
+        graph.AddTask([&workload, task] { workload.RunTask(task); });
+    }
+
+    for (const GraphEdge& edge : workload.edges)
+    {
+        graph.AddDependency(edge.from, edge.to);
+    }
+
+    int maxThreads = max(1u, thread::hardware_concurrency());
+
+    // 1, 2, 4, ... 그리고 하드웨어 스레드 개수
+    vector<int> threadCounts;
+
+    for (int threads = 1; threads < maxThreads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts)
+    {
+        ThreadPool pool{ threads };
+
+        TaskGraphReport report;
+
+        workload.values.assign(kTaskCount, 0);
+
+        graph.Run(pool, report);
+
+        bool isValid = (workload.values == expected) && IsValidSchedule(workload.edges, report);
+
+        cout << "TaskGraph threads : " << threads << ", " << report.elapsed << "s"
+             << ", Critical path : " << report.criticalPathLength << "s (" << report.criticalPath.size() << " tasks)"
+             << ", Parallelism : " << report.totalWork / report.criticalPathLength
+             << ", Steals : " << report.steals << (isValid ? "" : " (Mismatch!)") << '\n';
+    }
+
+    // 사이클이 있으면 실행하지 않아야 한다.
+    {
+        TaskGraph cyclic;
+
+        int a = cyclic.AddTask([] {});
+        int b = cyclic.AddTask([] {});
+
+        cyclic.AddDependency(a, b);
+        cyclic.AddDependency(b, a);
+
+        ThreadPool pool{ 1 };
+
+        TaskGraphReport report;
+
+        cout << "Cycle rejected : " << (false == cyclic.Run(pool, report) ? "yes" : "no (Mismatch!)") << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stop_token>
+#include <functional>
+#include <vector>
+#include <algorithm>
+
+// 데이터 병렬 처리용 스레드 풀
+// : [0, count) 범위의 작업을 모든 스레드가 나눠서 처리하는 ParallelFor()만 제공한다.
+//
+// 작업을 시작할 때마다 스레드를 만들면 생성 비용이 작업 시간보다 커질 수 있다.
+// 그래서 스레드는 미리 만들어 두고 ParallelFor()가 호출될 때마다 깨워서 사용한다.
+//
+// - 작업 인덱스는 atomic 카운터로 하나씩 가져가기 때문에 작업마다 비용이 달라도 부하가 고르게 분산된다.
+// - 호출한 스레드도 작업에 참여하기 때문에 threadCount개의 스레드 중 (threadCount - 1)개만 따로 만든다.
+// - ParallelFor()는 모든 작업이 끝날 때까지 반환하지 않는다.
+// - 소멸할 때는 std::jthread의 stop_token으로 대기 중인 스레드를 깨워서 종료시킨다(jthread.cpp 참고).
+
+class ThreadPool
+{
+public:
+    explicit ThreadPool(int threadCount = (int)std::max(1u, std::thread::hardware_concurrency()))
+        : _threadCount{ std::max(1, threadCount) }
+    {
+        for (int i = 1; i < _threadCount; i++)
+        {
+            _workers.emplace_back([this](std::stop_token stoken) { this->workerLoop(stoken); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        for (std::jthread& worker : _workers)
+        {
+            worker.request_stop();
+        }
+
+        _wakeCond.notify_all();
+
+        // 멤버 변수(뮤텍스, 조건 변수)가 소멸하기 전에 스레드가 종료되어야 한다.
+        _workers.clear();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+public:
+    template <typename Func>
+    void ParallelFor(size_t count, Func&& func)
+    {
+        if (0 == count)
+            return;
+
+        // 스레드가 하나뿐이라면 바로 처리한다.
+        if (1 == _threadCount)
+        {
+            for (size_t idx = 0; idx < count; idx++)
+            {
+                func(idx);
+            }
+
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{ _mutex };
+
+            _job     = [&func](size_t idx) { func(idx); };
+            _count   = count;
+            _running = _threadCount - 1;
+
+            _next.store(0, std::memory_order_relaxed);
+
+            _generation++;
+        }
+
+        _wakeCond.notify_all();
+
+        this->runJob();
+
+        // 나머지 스레드가 끝날 때까지 대기
+        std::unique_lock<std::mutex> lock{ _mutex };
+
+        _doneCond.wait(lock, [this] { return 0 == _running; });
+
+        _job = nullptr;
+    }
+
+    int ThreadCount() const { return _threadCount; }
+
+private:
+    void runJob()
+    {
+        size_t idx;
+
+        while ((idx = _next.fetch_add(1, std::memory_order_relaxed)) < _count)
+        {
+            _job(idx);
+        }
+    }
+
+    void workerLoop(std::stop_token stoken)
+    {
+        uint64_t seenGeneration = 0;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock{ _mutex };
+
+                // 새 작업이 들어오거나 종료 요청이 들어올 때까지 대기
+                _wakeCond.wait(lock, stoken, [&] { return _generation != seenGeneration; });
+
+                if (true == stoken.stop_requested())
+                    return;
+
+                seenGeneration = _generation;
+            }
+
+            this->runJob();
+
+            {
+                std::lock_guard<std::mutex> lock{ _mutex };
+
+                _running--;
+            }
+
+            _doneCond.notify_one();
+        }
+    }
+
+private:
+    int _threadCount;
+
+    std::vector<std::jthread> _workers;
+
+    std::mutex _mutex;
+    std::condition_variable_any _wakeCond;
+    std::condition_variable     _doneCond;
+
+    std::function<void(size_t)> _job;
+
+    size_t   _count      = 0;
+    int      _running    = 0;
+    uint64_t _generation = 0;
+
+    std::atomic<size_t> _next{ 0 };
+};
@@ -24,6 +24,9 @@ using namespace std;
 // 3. 더 이상 탐색할 수 없는 정점에 도달했다면 해당 정점을 리스트의 새로운 헤더로 등록
 // 4. 2번과 3번을 반복해서 정점이 남지 않을 때까지 수행
 
+// 재귀 DFS는 의존 관계가 길게 이어지면 스택 오버플로가 발생할 수 있다.
+// 반복문으로 처리하는 칸 알고리즘(Kahn's algorithm) 버전은 TopologicalSort.h 참고
+
 // 응용 문제) 백준 2252 : 줄 세우기
 
 int n;
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "CSRGraph.h"
+
+// 칸 알고리즘(Kahn's algorithm)을 사용한 위상 정렬
+// : TopologicalSort.cpp의 DFS 방식(go() 재귀 + 후위 순서)을 대체하는 진입 차수 기반 구현(재귀 없음)
+//
+// TopologicalSort.cpp(DFS 버전)의 문제점
+// - go()가 재귀 함수라서 의존 관계가 길게 이어지면(체인) 정점 개수만큼 재귀가 깊어져 스택 오버플로가 발생한다.
+// - list<int>::push_front()를 사용하기 때문에 정점마다 노드 할당이 일어난다.
+// - vector<int> adj[32004]로 크기가 고정되어 있고 정점마다 간선 배열을 따로 할당한다.
+//
+// 개선 사항
+// - 간선은 CSRGraph로 받는다(배열 3개에 몰아서 저장).
+// - 결과 배열(order)을 큐로 같이 사용한다.
+//   진입 차수가 0이 된 정점을 order의 끝에 쓰고 앞에서부터 하나씩 읽으면서 진출 간선을 제거한다.
+//   읽는 위치가 쓰는 위치를 따라잡으면 끝이다. 별도의 큐나 리스트가 필요 없다.
+// - 같은 단계(level)에 속한 정점의 경계를 같이 기록한다.
+//   level 0 : 처음부터 진입 차수가 0인 정점
+//   level k : level (k - 1)의 정점을 제거했을 때 진입 차수가 0이 되는 정점
+//   같은 level의 정점끼리는 의존 관계가 없기 때문에 동시에 실행할 수 있다(level의 개수 = 가장 긴 경로의 정점 수).
+//
+// order와 levels는 호출하는 쪽에서 넘기기 때문에 여러 번 호출해도 이전에 할당한 공간을 재사용한다.
+// 사이클이 있다면 사이클에 걸린 정점은 진입 차수가 0이 되지 않으므로 order의 크기가 정점 개수보다 작아진다(false 반환).
+
+template <typename W>
+bool KahnTopologicalSort(const CSRGraph<W>& graph, std::vector<int>& order, std::vector<size_t>* levels = nullptr)
+{
+    int vertexCount = graph.VertexCount();
+
+    std::vector<int> indegrees(vertexCount, 0);
+
+    for (int from = 0; from < vertexCount; from++)
+    {
+        for (int to : graph.Targets(from))
+        {
+            indegrees[to]++;
+        }
+    }
+
+    order.resize(vertexCount);
+
+    size_t tail = 0;
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        if (0 == indegrees[v])
+        {
+            order[tail++] = v;
+        }
+    }
+
+    // levels[k]부터 levels[k + 1] 전까지가 level k의 정점이다.
+    if (nullptr != levels)
+    {
+        levels->clear();
+        levels->push_back(0);
+    }
+
+    size_t head     = 0;
+    size_t levelEnd = tail;
+
+    while (head < tail)
+    {
+        int from = order[head++];
+
+        for (int to : graph.Targets(from))
+        {
+            if (0 == --indegrees[to])
+            {
+                order[tail++] = to;
+            }
+        }
+
+        // 현재 level의 마지막 정점까지 처리했다면 그동안 추가된 정점이 다음 level이다.
+        if (head == levelEnd)
+        {
+            if (nullptr != levels)
+            {
+                levels->push_back(levelEnd);
+            }
+
+            levelEnd = tail;
+        }
+    }
+
+    order.resize(tail);
+
+    return tail == (size_t)vertexCount;
+}
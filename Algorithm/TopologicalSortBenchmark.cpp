@@ -0,0 +1,193 @@
+#include <iostream>
+#include <chrono>
+#include <list>
+#include <vector>
+
+#include "GraphGenerator.h"
+#include "TopologicalSort.h"
+
+// TopologicalSort.h 측정
+//
+// 정점 1000만 개의 DAG에서 다음을 비교한다.
+// - Legacy       : TopologicalSort.cpp의 방식(vector<int> adj[N] + 재귀 DFS + list<int>::push_front())
+// - Kahn         : CSRGraph + KahnTopologicalSort()(level 경계 포함)
+// - Kahn (reuse) : 이미 할당된 order와 levels를 넘겨서 다시 호출
+//
+// 그래프를 구성하는 시간(Build)과 정렬하는 시간(Sort)을 나눠서 출력한다.
+//
+// 1. Wide  : 간선 4000만 개, 간선이 순서상 어디로든 건너뛸 수 있음(level이 적고 한 level에 정점이 많음)
+// 2. Chain : 모든 정점이 한 줄로 이어진 그래프
+//            예전 방식은 재귀 깊이가 정점 개수만큼 깊어져서 스택 오버플로가 발생하기 때문에 Kahn만 실행한다.
+//
+// 결과로 나온 순서에서 모든 간선이 앞 -> 뒤를 향하는지, level이 증가하는 방향인지 확인한다.
+//
+// !! 최적화 기능을 켠 상태에서 실행할 것 !!
+// 측정값은 컴파일러나 CPU 그리고 각종 환경에 따라 달라질 수 있음.
+
+using namespace std;
+
+using MyClock  = std::chrono::high_resolution_clock;
+using MySecond = std::chrono::duration<double>;
+
+constexpr int    kVertexCount = 10'000'000;
+constexpr size_t kEdgeCount   = 40'000'000;
+
+template <typename Func>
+double Measure(Func&& func)
+{
+    auto startTime = MyClock::now();
+
+    func();
+
+    auto endTime = MyClock::now();
+
+    return chrono::duration_cast<MySecond>(endTime - startTime).count();
+}
+
+// 비교용 : 예전 방식
+struct LegacyTopologicalSort
+{
+    vector<vector<int>> adj;
+    vector<bool>        visited;
+
+    list<int> res;
+
+    void go(int from)
+    {
+        visited[from] = true;
+
+        for (int to : adj[from])
+        {
+            if (true == visited[to])
+                continue;
+
+            go(to);
+        }
+
+        res.push_front(from);
+    }
+};
+
+bool IsValidOrder(int vertexCount, const vector<GraphEdge>& edges, const vector<int>& order)
+{
+    if ((int)order.size() != vertexCount)
+        return false;
+
+    vector<int> pos(vertexCount);
+
+    for (int idx = 0; idx < vertexCount; idx++)
+    {
+        pos[order[idx]] = idx;
+    }
+
+    for (const GraphEdge& edge : edges)
+    {
+        if (pos[edge.from] >= pos[edge.to])
+            return false;
+    }
+
+    return true;
+}
+
+bool IsValidLevels(int vertexCount, const vector<GraphEdge>& edges, const vector<int>& order, const vector<size_t>& levels)
+{
+    if (levels.empty() || levels.back() != (size_t)vertexCount)
+        return false;
+
+    vector<int> levelOf(vertexCount);
+
+    for (size_t level = 0; level + 1 < levels.size(); level++)
+    {
+        for (size_t idx = levels[level]; idx < levels[level + 1]; idx++)
+        {
+            levelOf[order[idx]] = (int)level;
+        }
+    }
+
+    for (const GraphEdge& edge : edges)
+    {
+        if (levelOf[edge.from] >= levelOf[edge.to])
+            return false;
+    }
+
+    return true;
+}
+
+void RunKahn(const vector<GraphEdge>& edges)
+{
+    CSRGraph<int> graph;
+
+    double buildTime = Measure([&] { graph = CSRGraph<int>{ kVertexCount, edges }; });
+
+    vector<int>    order;
+    vector<size_t> levels;
+
+    double sortTime  = Measure([&] { KahnTopologicalSort(graph, order, &levels); });
+    double reuseTime = Measure([&] { KahnTopologicalSort(graph, order, &levels); });
+
+    bool isValid = IsValidOrder(kVertexCount, edges, order) && IsValidLevels(kVertexCount, edges, order, levels);
+
+    cout << "Kahn         : Build " << buildTime << "s, Sort " << sortTime << "s, Levels : " << levels.size() - 1
+         << (isValid ? "" : " (Mismatch!)") << '\n';
+    cout << "Kahn (reuse) : Sort " << reuseTime << "s\n";
+}
+
+void RunLegacy(const vector<GraphEdge>& edges)
+{
+    LegacyTopologicalSort legacy;
+
+    double buildTime = Measure([&] {
+        legacy.adj.resize(kVertexCount);
+        legacy.visited.assign(kVertexCount, false);
+
+        for (const GraphEdge& edge : edges)
+        {
+            legacy.adj[edge.from].push_back(edge.to);
+        }
+    });
+
+    double sortTime = Measure([&] {
+        vector<int> indegrees(kVertexCount, 0);
+
+        for (const GraphEdge& edge : edges)
+        {
+            indegrees[edge.to]++;
+        }
+
+        for (int v = 0; v < kVertexCount; v++)
+        {
+            if (0 == indegrees[v])
+            {
+                legacy.go(v);
+            }
+        }
+    });
+
+    vector<int> order(legacy.res.begin(), legacy.res.end());
+
+    bool isValid = IsValidOrder(kVertexCount, edges, order);
+
+    cout << "Legacy       : Build " << buildTime << "s, Sort " << sortTime << "s" << (isValid ? "" : " (Mismatch!)") << '\n';
+}
+
+int main()
+{
+    {
+        vector<GraphEdge> edges = MakeRandomDag(kVertexCount, kEdgeCount, kVertexCount);
+
+        cout << "Wide  (V : " << kVertexCount << ", E : " << edges.size() << ")\n";
+
+        RunLegacy(edges);
+        RunKahn(edges);
+    }
+
+    {
+        vector<GraphEdge> edges = MakeRandomDag(kVertexCount, 0, 1);
+
+        cout << "\nChain (V : " << kVertexCount << ", E : " << edges.size() << ")\n";
+
+        RunKahn(edges);
+    }
+
+    return 0;
+}